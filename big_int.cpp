@@ -8,134 +8,430 @@
 
 #include <iostream>
 #include <vector>
+#include <algorithm>
 #include <cstdint>
-#include <sstream>
+#include <atomic>
+#include <bit>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <functional>
 #include "big_int.hpp"
+#include "big_int_stats.hpp"
+#include "thread_pool.hpp"
 using namespace std;
 
-/******************************* Constructors ******************************/
-big_int::big_int() : coefficient({0}){};
+// Counts the enclosing operation when the library is built with BIG_INT_INSTRUMENT, see big_int_stats.hpp
+#ifdef BIG_INT_INSTRUMENT
+#define BIG_INT_COUNT_OPERATION(operation, size) big_int_operation_scope counted_operation(operation, size)
+#else
+#define BIG_INT_COUNT_OPERATION(operation, size)
+#endif
+
+// The thresholds measured on a machine by big_int_tune, see the CMake option BIG_INT_TUNED_HEADER
+#ifdef BIG_INT_TUNED_HEADER
+#include BIG_INT_TUNED_HEADER
+#endif
+#ifndef BIG_INT_KARATSUBA_THRESHOLD
+#define BIG_INT_KARATSUBA_THRESHOLD 32
+#endif
+#ifndef BIG_INT_PARALLEL_MULTIPLY_THRESHOLD
+#define BIG_INT_PARALLEL_MULTIPLY_THRESHOLD 1024
+#endif
+#ifndef BIG_INT_DIVISION_THRESHOLD
+#define BIG_INT_DIVISION_THRESHOLD 4096
+#endif
+#ifndef BIG_INT_CONVERSION_THRESHOLD
+#define BIG_INT_CONVERSION_THRESHOLD 64
+#endif
+#ifndef BIG_INT_PARALLEL_CONVERSION_THRESHOLD
+#define BIG_INT_PARALLEL_CONVERSION_THRESHOLD 2048
+#endif
+
+// Number of coefficients of the smaller integer from which multiplication uses the Karatsuba method
+static atomic<uint64_t> karatsuba_coefficients{BIG_INT_KARATSUBA_THRESHOLD};
+
+// Number of coefficients of the smaller integer from which the parts of a multiplication run in parallel
+static atomic<uint64_t> parallel_multiply_coefficients{BIG_INT_PARALLEL_MULTIPLY_THRESHOLD};
+
+// Number of coefficients of the divisor and of the quotient from which division uses Barrett reduction
+static atomic<uint64_t> division_coefficients{BIG_INT_DIVISION_THRESHOLD};
+
+// Number of coefficients from which print_base10 uses the divide and conquer method
+static atomic<uint64_t> conversion_coefficients{BIG_INT_CONVERSION_THRESHOLD};
+
+// Number of coefficients from which the halves of an integer are converted to a string in parallel
+static atomic<uint64_t> parallel_conversion_coefficients{BIG_INT_PARALLEL_CONVERSION_THRESHOLD};
+
+// Number of characters given at a time to the function of a digit stream
+static const uint64_t stream_chunk_size = 1 << 16;
 
-big_int::big_int(const int64_t &integer)
+/**
+ * @brief Helper class that converts big integers to and from strings with the divide and conquer method, and divides
+ *        big integers
+ * @details The integer is split by a power of the radix into a high and a low half whose digits are written
+ *          independently (in parallel for large halves) into their own positions of one string. The powers are
+ *          radix^(digits per coefficient * 2^k), found by squaring, and division by a power uses multiplications by its
+ *          precomputed reciprocal (Barrett reduction), thus a split costs about as much as a multiplication.
+ *          Reading a string does the reverse, the high and low digits are read independently (in parallel for long
+ *          strings) and combined as high * power + low.
+ */
+class big_int_conversion
 {
-    // Add the coefficients/digits for the integer in base 2^32
-    uint64_t value = integer;
-    // If value is negative save as a positive and update sign
-    if (integer < 0)
-    {
-        integer_sign = sign::NEGATIVE;
-        value = -integer;
-    }
-
-    // Divide by base of 2^32 and add remainder to the coefficient vector of digits
-    uint32_t remainder = (uint32_t)(value % base);
-    coefficient.push_back(remainder);
-    while (value >= base)
+public:
+    // A power of the radix that an integer is split by
+    struct radix_power
     {
-        value = value / base;
-        remainder = (uint32_t)(value % base); // remainder always < base
-        coefficient.push_back(remainder);
-    }
-}
+        // The power shifted left until its most significant bit is set
+        big_int value;
 
-big_int::big_int(const string &integer) : coefficient((1))
-{
-    string integer_temp = integer;
-    // Check to see if 1st digit is a "+" or "-" sign and remove
-    if (integer[0] == '+')
-    {
-        integer_sign = sign::POSITIVE;
-        integer_temp.erase(0, 1);
-    }
-    else if (integer[0] == '-')
-    {
-        integer_sign = sign::NEGATIVE;
-        integer_temp.erase(0, 1);
-    }
+        // floor(base^(2 * size) / value)
+        big_int reciprocal;
 
-    // For each digit character in the string multiply the big integer by 10 and then add the digit value
-    for (const char &digit : integer_temp)
-    {
-        // Check to make sure digit is from 0 to 9
-        if (isdigit(digit) == 0)
-        {
-            throw invalid_string_integer();
-        }
+        // Number of bits the power was shifted left
+        uint64_t shift;
 
-        multiply_32(10);
-        add_32(digit - '0'); // the character digit will have ascii value thus this value minus the value at 0 will give base 10 digit value
-    }
-}
+        // Number of coefficients of the shifted power
+        uint64_t size;
+    };
 
-big_int::big_int(const big_int &big_integer)
-{
-    // Copy the digits of the argument big integer
-    for (const uint32_t &digits : big_integer.coefficient)
+    // Digits written in chunks to a function as they are found, most significant first
+    struct digit_stream
     {
-        coefficient.push_back(digits);
-    }
+        // The powers of the radix, values[k] is 1 followed by chunk_digits * 2^k zeros
+        vector<big_int> values;
+
+        // The same powers prepared for division
+        vector<radix_power> powers;
+
+        // The radix of the digits
+        uint32_t radix;
+
+        // The largest power of the radix that fits in a coefficient and its exponent
+        uint32_t chunk;
+        uint64_t chunk_digits;
+
+        // The digits not yet given to the function
+        string buffer;
+        uint64_t used;
+
+        // The function that receives each chunk of digits
+        const function<void(const char *, const uint64_t &)> &sink;
+    };
+
+    /**
+     * @brief Converts a big integer to a string of digits in a radix, with a + or - sign in the beginning
+     * @param integer The big_int to convert
+     * @param radix The radix of the digits, from 2 to 36
+     * @return A string containing the sign and digits of the integer
+     */
+    static string to_radix_string(const big_int &integer, const uint32_t &radix);
+
+    /**
+     * @brief Converts a string of digits in a radix, with an optional + or - sign in the beginning, to a big integer
+     * @details Throws invalid_string_integer if a character is not a digit of the radix
+     * @param integer The string to convert
+     * @param radix The radix of the digits, from 2 to 36
+     * @return The big_int the string represents
+     */
+    static big_int from_radix_string(const string &integer, const uint32_t &radix);
+
+    /**
+     * @brief Writes the digits of the magnitude of a big integer, without a sign, to a buffer
+     * @param integer The big_int to write
+     * @param first The first character of the buffer
+     * @param last The character after the buffer
+     * @param radix The radix of the digits, from 2 to 36
+     * @return The character after the last digit written, or nullptr if the digits do not fit
+     */
+    static char *write_chars(const big_int &integer, char *first, char *last, const uint32_t &radix);
+
+    /**
+     * @brief Finds an upper bound of the number of digits of the magnitude of a big integer
+     * @param integer The big_int
+     * @param radix The radix of the digits, from 2 to 36
+     * @return The number of digits for a power of two radix, otherwise at most two more than the number of digits
+     */
+    static uint64_t digit_bound(const big_int &integer, const uint32_t &radix);
+
+    /**
+     * @brief Reads a string of digits without a sign
+     * @details Throws invalid_string_integer if a character is not a digit of the radix
+     * @param in The first digit to read
+     * @param length The number of digits to read
+     * @param radix The radix of the digits, from 2 to 36
+     * @param negative True if the digits had a - sign
+     * @return The big_int the digits represent
+     */
+    static big_int read_radix(const char *in, const uint64_t &length, const uint32_t &radix, const bool &negative);
+
+    /**
+     * @brief Checks if a big integer is negative, zero is never negative
+     * @param integer The big_int to check
+     * @return True if the integer is less than zero
+     */
+    static bool is_negative(const big_int &integer);
+
+    /**
+     * @brief Checks if a character is a digit of a radix
+     * @param symbol The character
+     * @param radix The radix of the digits
+     * @return True if the character is a digit of the radix
+     */
+    static bool is_digit(const char &symbol, const uint32_t &radix);
+
+    /**
+     * @brief Writes the digits of a big integer, with a + or - sign in the beginning, in chunks of at most
+     *        stream_chunk_size characters, most significant first
+     * @details Only the high half of each split is split again before its digits are written, thus the first chunk is
+     *          ready after about two multiplications of the size of the integer and no string of all the digits is built
+     * @param integer The big_int to write
+     * @param radix The radix of the digits, from 2 to 36
+     * @param sink The function called with each chunk of digits and its number of characters
+     */
+    static void stream_radix(const big_int &integer, const uint32_t &radix, const function<void(const char *, const uint64_t &)> &sink);
+
+    /**
+     * @brief Divides the magnitudes of two big integers
+     * @details Uses Barrett reduction by the reciprocal of the divisor if both the divisor and the quotient have at least
+     *          division_threshold() coefficients, and long division (Knuth's algorithm D) otherwise
+     * @param dividend The big_int to divide
+     * @param divisor The big_int to divide by, not zero
+     * @return floor(|dividend| / |divisor|)
+     */
+    static big_int divide(const big_int &dividend, const big_int &divisor);
+
+private:
+    /**
+     * @brief Finds the largest power of the radix that fits in a coefficient, the digits are converted a coefficient at a time
+     * @param radix The radix of the digits
+     * @param chunk Set to the largest power of the radix that fits in a coefficient
+     * @return The exponent of chunk
+     */
+    static uint64_t chunk_power(const uint32_t &radix, uint32_t &chunk);
+    /**
+     * @brief Multiplies a big integer by 2^bits
+     * @param integer The big_int to shift
+     * @param bits The number of bits to shift left
+     * @return The shifted big_int
+     */
+    static big_int shift_left(const big_int &integer, const uint64_t &bits);
+
+    /**
+     * @brief Divides the magnitude of a big integer by 2^bits, keeping the sign (ie rounds towards zero)
+     * @param integer The big_int to shift
+     * @param bits The number of bits to shift right
+     * @return The shifted big_int
+     */
+    static big_int shift_right(const big_int &integer, const uint64_t &bits);
+
+    /**
+     * @brief Creates the big integer base^exponent where base is 2^32
+     * @param exponent The number of zero coefficients
+     * @return The power of the base
+     */
+    static big_int power_of_base(const uint64_t &exponent);
+
+    /**
+     * @brief Divides two vectors of coefficients with long division (Knuth's algorithm D)
+     * @details The digits of the quotient are estimated from the two leading digits of the remainder and the divisor,
+     *          which is shifted left until its most significant bit is set so each estimate is off by at most 2
+     * @param dividend The coefficients of the dividend
+     * @param divisor The coefficients of the divisor, the most significant one is not zero
+     * @return The coefficients of the quotient
+     */
+    static vector<uint32_t> divide_digits(const vector<uint32_t> &dividend, const vector<uint32_t> &divisor);
+
+    /**
+     * @brief Finds floor(base^(2 * n) / divisor) for a divisor of n coefficients with the most significant bit set
+     * @details Uses Newton's method x = x + x * (base^(2n) - divisor * x) / base^(2n) starting from the reciprocal
+     *          of the leading half of the divisor, which doubles the number of correct digits
+     * @param divisor The big_int to find the reciprocal of
+     * @return The reciprocal
+     */
+    static big_int reciprocal(const big_int &divisor);
+
+    /**
+     * @brief Prepares a power of the radix for division by it
+     * @param power The power of the radix
+     * @return The shifted power and its reciprocal
+     */
+    static radix_power make_power(const big_int &power);
+
+    /**
+     * @brief Divides a non negative big integer less than the square of a power by the power (Barrett reduction)
+     * @param dividend The big_int to divide
+     * @param power The power to divide by
+     * @param quotient The quotient of the division
+     * @param remainder The remainder of the division
+     */
+    static void divide_by_power(const big_int &dividend, const radix_power &power, big_int &quotient, big_int &remainder);
+
+    /**
+     * @brief Divides the magnitudes of two big integers with Barrett reduction
+     * @details The dividend is divided n coefficients at a time from the most significant, where n is the size of the
+     *          divisor, thus each step divides a number less than base^(2n) by the divisor with two multiplications
+     * @param dividend The big_int to divide
+     * @param divisor The big_int to divide by, its most significant coefficient is not zero
+     * @return floor(|dividend| / |divisor|)
+     */
+    static big_int divide_barrett(const big_int &dividend, const big_int &divisor);
+
+    /**
+     * @brief Writes the digits of a non negative big integer by repeated division by the largest power of the radix that fits in a coefficient
+     * @param integer The big_int to write
+     * @param out The characters to write to, the digits are right aligned and padded with zeros
+     * @param width The number of characters to write
+     * @param radix The radix of the digits
+     * @param chunk The largest power of the radix that fits in a coefficient
+     * @param chunk_digits The number of digits of chunk minus one (ie the exponent of chunk)
+     */
+    static void write_small(const big_int &integer, char *out, const uint64_t &width, const uint32_t &radix, const uint32_t &chunk, const uint64_t &chunk_digits);
+
+    /**
+     * @brief Writes the digits of a non negative big integer less than the power at the given level
+     * @param integer The big_int to write
+     * @param powers The powers of the radix, powers[k] has chunk_digits * 2^k zeros
+     * @param level The level of the power the integer is less than
+     * @param out The characters to write to, exactly chunk_digits * 2^level digits are written
+     * @param radix The radix of the digits
+     * @param chunk The largest power of the radix that fits in a coefficient
+     * @param chunk_digits The exponent of chunk
+     */
+    static void write_digits(const big_int &integer, const vector<radix_power> &powers, const uint64_t &level, char *out, const uint32_t &radix, const uint32_t &chunk, const uint64_t &chunk_digits);
+
+    /**
+     * @brief Writes the digits of a non negative big integer without leading zeros, right aligned before end, by repeated
+     *        division by the largest power of the radix that fits in a coefficient
+     * @details A small integer is copied to the stack for the division, thus no memory is allocated
+     * @param integer The big_int to write
+     * @param limit The first character that can be written
+     * @param end The character after the last digit
+     * @param radix The radix of the digits
+     * @param chunk The largest power of the radix that fits in a coefficient
+     * @param chunk_digits The exponent of chunk
+     * @return The first digit written, or nullptr if the digits do not fit after limit
+     */
+    static char *write_leading_small(const big_int &integer, char *limit, char *end, const uint32_t &radix, const uint32_t &chunk, const uint64_t &chunk_digits);
+
+    /**
+     * @brief Writes the digits of a non negative big integer less than values[level] without leading zeros, right aligned before end
+     * @details The low digits of every split are written with write_digits and only the high half is split again
+     * @param integer The big_int to write
+     * @param values The powers of the radix, values[k] is 1 followed by chunk_digits * 2^k zeros
+     * @param powers The same powers prepared for division
+     * @param level The level of the power the integer is less than
+     * @param limit The first character that can be written
+     * @param end The character after the last digit
+     * @param radix The radix of the digits
+     * @param chunk The largest power of the radix that fits in a coefficient
+     * @param chunk_digits The exponent of chunk
+     * @return The first digit written, or nullptr if the digits do not fit after limit
+     */
+    static char *write_leading(const big_int &integer, const vector<big_int> &values, const vector<radix_power> &powers, const uint64_t &level, char *limit, char *end, const uint32_t &radix, const uint32_t &chunk, const uint64_t &chunk_digits);
+
+    /**
+     * @brief Gives the buffered digits of a stream to its function
+     * @param stream The digit stream
+     */
+    static void flush_stream(digit_stream &stream);
+
+    /**
+     * @brief Streams the digits of a non negative big integer less than values[level] without leading zeros
+     * @param integer The big_int to write
+     * @param level The level of the power the integer is less than
+     * @param stream The digit stream
+     */
+    static void stream_leading(const big_int &integer, const uint64_t &level, digit_stream &stream);
+
+    /**
+     * @brief Streams exactly chunk_digits * 2^level digits of a non negative big integer less than values[level]
+     * @param integer The big_int to write
+     * @param level The level of the power the integer is less than
+     * @param stream The digit stream
+     */
+    static void stream_digits(const big_int &integer, const uint64_t &level, digit_stream &stream);
+
+    /**
+     * @brief Gets the value of a digit character in a radix
+     * @details Throws invalid_string_integer if the character is not a digit of the radix
+     * @param symbol The character 0-9, a-z or A-Z
+     * @param radix The radix of the digit
+     * @return The value of the digit
+     */
+    static uint32_t digit_value(const char &symbol, const uint32_t &radix);
+
+    /**
+     * @brief Reads digits by multiplying by the largest power of the radix that fits in a coefficient and adding the next chunk of digits
+     * @param in The first digit to read
+     * @param length The number of digits to read
+     * @param radix The radix of the digits
+     * @param chunk_digits The exponent of the largest power of the radix that fits in a coefficient
+     * @return The non negative big_int the digits represent
+     */
+    static big_int read_small(const char *in, const uint64_t &length, const uint32_t &radix, const uint64_t &chunk_digits);
+
+    /**
+     * @brief Writes the digits of a big integer in a power of two radix, each digit is a group of bits of the
+     *        coefficients thus it takes linear time
+     * @param integer The big_int to write
+     * @param out The characters to write to
+     * @param count The number of digits to write, the most significant first
+     * @param radix The radix of the digits, a power of two
+     */
+    static void write_bits(const big_int &integer, char *out, const uint64_t &count, const uint32_t &radix);
+
+    /**
+     * @brief Finds the number of digits of a big integer in a power of two radix
+     * @param integer The big_int
+     * @param radix The radix of the digits, a power of two
+     * @return The number of digits without leading zeros, 1 for zero
+     */
+    static uint64_t bit_digits(const big_int &integer, const uint32_t &radix);
+
+    /**
+     * @brief Reads digits in a power of two radix by placing the bits of each digit in the coefficients, in linear time
+     * @param in The first digit to read
+     * @param length The number of digits to read
+     * @param radix The radix of the digits, a power of two
+     * @return The non negative big_int the digits represent
+     */
+    static big_int read_bits(const char *in, const uint64_t &length, const uint32_t &radix);
+
+    /**
+     * @brief Reads digits by splitting them into high and low digits, which are read independently
+     * @param in The first digit to read
+     * @param length The number of digits to read
+     * @param values The powers of the radix, values[k] is 1 followed by chunk_digits * 2^k zeros
+     * @param radix The radix of the digits
+     * @param chunk_digits The exponent of the largest power of the radix that fits in a coefficient
+     * @return The non negative big_int the digits represent
+     */
+    static big_int read_digits(const char *in, const uint64_t &length, const vector<big_int> &values, const uint32_t &radix, const uint64_t &chunk_digits);
+};
 
-    // update the sign of the new big int to that of the argument
-    integer_sign = big_integer.get_sign();
-}
+/******************************* Constructors ******************************/
+big_int::big_int(const string &integer) : big_int(big_int_conversion::from_radix_string(integer, 10)){};
 
-big_int::big_int(const vector<uint32_t> &vec)
+/******************************* Public Functions ******************************/
+string big_int::to_string(const uint32_t &radix) const
 {
-    // Reverse the vector such that the most significant digit is at the last index
-    coefficient.reserve(vec.size());
-    for (uint64_t i = vec.size(); i > 0; i--)
+    if (radix < 2 || radix > 36)
     {
-        coefficient.push_back(vec[i - 1]);
+        throw invalid_radix();
     }
+    return big_int_conversion::to_radix_string(*this, radix);
 }
 
-/******************************** Public Functions ******************************/
-
-void big_int::negate()
+big_int big_int::from_string(const string &integer, const uint32_t &radix)
 {
-    // Change sign flag
-    if (integer_sign == sign::POSITIVE)
-    {
-        integer_sign = sign::NEGATIVE;
-    }
-    else
+    if (radix < 2 || radix > 36)
     {
-        integer_sign = sign::POSITIVE;
+        throw invalid_radix();
     }
+    return big_int_conversion::from_radix_string(integer, radix);
 }
 
-const uint32_t &big_int::at(const uint64_t &index) const
-{
-    return coefficient.at(index);
-}
-
-uint64_t big_int::coefficient_size() const
-{
-    return coefficient.size();
-}
-
-const sign &big_int::get_sign() const
-{
-    return integer_sign;
-}
-
-// Referenced: https://en.cppreference.com/w/cpp/language/operators
-big_int &big_int::operator=(const big_int &big_integer)
-{
-
-    // Self assignment
-    if (this == &big_integer)
-    {
-        return *this;
-    }
-
-    // Set the coefficient and integer_sign of this object to that of argument
-    coefficient = big_integer.coefficient;
-    integer_sign = big_integer.get_sign();
-
-    // return object
-    return *this;
-}
 /******************************* Private Functions ******************************/
 void big_int::multiply_32(const uint32_t &integer)
 {
@@ -208,443 +504,1451 @@ uint32_t big_int::remainder_32(const uint32_t &integer) const
     return (uint32_t)remainder;
 }
 
-vector<uint32_t> big_int::radix_complement() const
+void big_int::expand(uint64_t const &num_zeros)
 {
-    vector<uint32_t> complement;
-    // Ged the radix - 1
-    uint32_t radix_minus1 = (uint32_t)(base - 1);
-
-    // Find radix - 1 complement and then add 1 to get radix complement
-    for (const uint32_t &digit : coefficient)
+    for (uint64_t i = 0; i < num_zeros; i++)
     {
-        complement.push_back(radix_minus1 - digit);
+        coefficient.push_back(0);
     }
+}
 
-    // Add 1 to the big int and check carry
-    uint64_t temp = complement[0] + 1;
-    complement[0] = (uint32_t)(temp & (uint64_t)UINT32_MAX); // keep the low 32 bits
-    uint64_t carry = temp >> 32;
-
-    // If a carry exists add it to the next element in vector if it exist and recheck
-    for (uint64_t i = 1; i < complement.size() && carry != 0; i++)
+/**
+ * @brief Adds the coefficients of a vector multiplied by a 32 bit integer to the coefficients at destination
+ * @param destination The coefficients to add to, at least size of them
+ * @param source The coefficients to multiply
+ * @param size The number of coefficients in source
+ * @param multiplier a 32 bit integer
+ * @return The carry out of the most significant coefficient
+ */
+static uint32_t add_multiple(uint32_t *destination, const uint32_t *source, const uint64_t &size, const uint32_t &multiplier)
+{
+    uint64_t carry = 0;
+    for (uint64_t i = 0; i < size; i++)
     {
-        uint64_t temp = complement[i] + carry;
-        complement[i] = (uint32_t)(temp & (uint64_t)UINT32_MAX); // keep the low 32 bits
-        carry = temp >> 32;                                      // shift temp to the right by 32 bits to get the carry bit
+        uint64_t temp = (source[i] * (uint64_t)multiplier) + destination[i] + carry;
+        destination[i] = (uint32_t)(temp & (uint64_t)UINT32_MAX);
+        carry = temp >> 32;
     }
+    return (uint32_t)carry;
+}
 
-    // If the carry is not 0, need to add a new element with the value of carry
-    if (carry != 0)
+/**
+ * @brief Subtracts the coefficients of a vector multiplied by a 32 bit integer from the coefficients at destination
+ * @param destination The coefficients to subtract from, at least size of them
+ * @param source The coefficients to multiply
+ * @param size The number of coefficients in source
+ * @param multiplier a 32 bit integer
+ * @return The borrow out of the most significant coefficient
+ */
+static uint32_t subtract_multiple(uint32_t *destination, const uint32_t *source, const uint64_t &size, const uint32_t &multiplier)
+{
+    uint64_t borrow = 0;
+    for (uint64_t i = 0; i < size; i++)
     {
-        complement.push_back((uint32_t)carry);
+        uint64_t temp = (source[i] * (uint64_t)multiplier) + borrow;
+        uint32_t low = (uint32_t)(temp & (uint64_t)UINT32_MAX);
+        borrow = temp >> 32;
+        if (destination[i] < low)
+        {
+            borrow++;
+        }
+        destination[i] = destination[i] - low;
     }
-
-    return complement;
+    return (uint32_t)borrow;
 }
 
-void big_int::expand(uint64_t const &num_zeros)
+/**
+ * @brief Adds the coefficients of source to the coefficients of destination and propagates the carry through destination
+ * @param destination The coefficients to add to
+ * @param destination_size The number of coefficients in destination, at least source_size
+ * @param source The coefficients to add
+ * @param source_size The number of coefficients in source
+ * @return The carry out of the most significant coefficient of destination
+ */
+static uint32_t add_digits(uint32_t *destination, const uint64_t &destination_size, const uint32_t *source, const uint64_t &source_size)
 {
-    for (uint64_t i = 0; i < num_zeros; i++)
+    uint64_t carry = 0;
+    uint64_t i = 0;
+    for (; i < source_size; i++)
     {
-        coefficient.push_back(0);
+        uint64_t temp = destination[i] + (uint64_t)source[i] + carry;
+        destination[i] = (uint32_t)(temp & (uint64_t)UINT32_MAX);
+        carry = temp >> 32;
     }
+    for (; i < destination_size && carry != 0; i++)
+    {
+        uint64_t temp = destination[i] + carry;
+        destination[i] = (uint32_t)(temp & (uint64_t)UINT32_MAX);
+        carry = temp >> 32;
+    }
+    return (uint32_t)carry;
 }
 
-void big_int::shrink()
+/**
+ * @brief Subtracts the coefficients of source from the coefficients of destination and propagates the borrow through destination
+ * @param destination The coefficients to subtract from
+ * @param destination_size The number of coefficients in destination, at least source_size
+ * @param source The coefficients to subtract
+ * @param source_size The number of coefficients in source
+ * @return The borrow out of the most significant coefficient of destination
+ */
+static uint32_t subtract_digits(uint32_t *destination, const uint64_t &destination_size, const uint32_t *source, const uint64_t &source_size)
 {
-    // Do not shrink if value is 0 with only one digit
-    if (coefficient.size() > 1)
+    uint32_t borrow = 0;
+    uint64_t i = 0;
+    for (; i < source_size; i++)
     {
-        // Remove all leading zeros until reach a digit that is not zero
-        bool number_reached = false;
-        for (uint64_t i = coefficient.size() - 1; i > 0 && !number_reached; i--)
-        {
-            if (coefficient[i] == 0)
-            {
-                coefficient.erase(coefficient.begin() + i);
-            }
-            else
-            {
-                number_reached = true;
-            }
-        }
+        uint64_t subtrahend = (uint64_t)source[i] + borrow;
+        borrow = destination[i] < subtrahend ? 1 : 0;
+        destination[i] = (uint32_t)((destination[i] - subtrahend) & (uint64_t)UINT32_MAX);
+    }
+    for (; i < destination_size && borrow != 0; i++)
+    {
+        borrow = destination[i] == 0 ? 1 : 0;
+        destination[i] = destination[i] - 1;
     }
+    return borrow;
 }
 
-/******************************* Friend Functions ******************************/
-
-big_int operator+(const big_int &int_a, const big_int &int_b)
+/**
+ * @brief Multiplies two vectors of coefficients
+ * @details Uses the basic method below the Karatsuba threshold. Above it the integers are split in a low and a high
+ *          half and only three products of halves are needed: low * low, high * high and (low + high) * (low + high).
+ *          Above the parallel threshold these three products are run in parallel on the shared thread pool.
+ * @param result The a_size + b_size coefficients of the product, overwritten
+ * @param a The coefficients of the first integer
+ * @param a_size The number of coefficients in a
+ * @param b The coefficients of the second integer
+ * @param b_size The number of coefficients in b
+ */
+static void multiply_digits(uint32_t *result, const uint32_t *a, const uint64_t &a_size, const uint32_t *b, const uint64_t &b_size)
 {
-    big_int sum;
-    // Both integers are negative case
-    if (int_a.get_sign() == sign::NEGATIVE && int_b.get_sign() == sign ::NEGATIVE)
+    // Let a be the integer with fewer coefficients
+    if (a_size > b_size)
     {
-        // add the two big integers (no need for radix complement since both are negative)
-        sum.coefficient = add_coefficients(int_a.coefficient, int_b.coefficient);
-
-        // Change the sign of sum big int to negative
-        sum.integer_sign = sign::NEGATIVE;
+        multiply_digits(result, b, b_size, a, a_size);
+        return;
     }
 
-    // first int is negative and 2nd is positive
-    else if (int_a.get_sign() == sign::NEGATIVE && int_b.get_sign() == sign::POSITIVE)
+    uint64_t size = a_size + b_size;
+    fill(result, result + size, 0);
+    bool parallel = a_size >= parallel_multiply_coefficients && big_int_thread_pool().size() > 1;
+
+    // Basic method, the carry of each row goes to a coefficient no earlier row has written to
+    if (a_size < karatsuba_coefficients)
+    {
+        for (uint64_t i = 0; i < a_size; i++)
+        {
+            result[i + b_size] = add_multiple(result + i, b, b_size, a[i]);
+        }
+    }
+    // Very different sizes, multiply a by pieces of b that are the size of a and add the products
+    else if (b_size >= 2 * a_size)
     {
-        // add radix of a and b coefficient
-        sum.coefficient = add_coefficients(int_a.radix_complement(), int_b.coefficient);
+        uint64_t pieces = (b_size + a_size - 1) / a_size;
+        vector<vector<uint32_t>> products(pieces);
+        auto multiply_piece = [&](uint64_t piece)
+        {
+            uint64_t offset = piece * a_size;
+            uint64_t piece_size = min(a_size, b_size - offset);
+            products[piece].resize(a_size + piece_size);
+            multiply_digits(products[piece].data(), a, a_size, b + offset, piece_size);
+        };
+
+        if (parallel)
+            parallel_for(big_int_thread_pool(), pieces, multiply_piece);
+        else
+            for (uint64_t piece = 0; piece < pieces; piece++)
+                multiply_piece(piece);
 
-        /* update sum big int sign to negative if int_a is a bigger value
-           and update the sum digits to the radix complement (since result is negative and in radix complement form)*/
-        if (int_a.coefficient_size() > int_b.coefficient_size())
+        for (uint64_t piece = 0; piece < pieces; piece++)
         {
-            sum.integer_sign = sign::NEGATIVE;
-            sum.coefficient = sum.radix_complement();
+            uint64_t offset = piece * a_size;
+            add_digits(result + offset, size - offset, products[piece].data(), products[piece].size());
         }
-        else if (int_a.coefficient_size() == int_b.coefficient_size())
+    }
+    // Karatsuba method with a = a_high * base^half + a_low and b = b_high * base^half + b_low
+    else
+    {
+        uint64_t half = b_size / 2;
+        uint64_t a_high_size = a_size - half;
+        uint64_t b_high_size = b_size - half;
+
+        // Sums of the low and high halves, they can have one more coefficient than the larger half
+        vector<uint32_t> a_sum(max(half, a_high_size) + 1, 0);
+        vector<uint32_t> b_sum(max(half, b_high_size) + 1, 0);
+        copy(a, a + half, a_sum.begin());
+        add_digits(a_sum.data(), a_sum.size(), a + half, a_high_size);
+        copy(b, b + half, b_sum.begin());
+        add_digits(b_sum.data(), b_sum.size(), b + half, b_high_size);
+
+        vector<uint32_t> low(2 * half);
+        vector<uint32_t> high(a_high_size + b_high_size);
+        vector<uint32_t> middle(a_sum.size() + b_sum.size());
+        auto multiply_low = [&]
+        { multiply_digits(low.data(), a, half, b, half); };
+        auto multiply_high = [&]
+        { multiply_digits(high.data(), a + half, a_high_size, b + half, b_high_size); };
+        auto multiply_middle = [&]
+        { multiply_digits(middle.data(), a_sum.data(), a_sum.size(), b_sum.data(), b_sum.size()); };
+
+        if (parallel)
         {
-            uint64_t size = int_a.coefficient_size();
-            // Loop through each digit until find one that is bigger than the other, indicating which int is bigger overall
-            for (uint64_t index = size; index > 0; index--)
-            {
-                // set sign to negative and set digits to the radix complement
-                if (int_a.coefficient[index - 1] > int_b.coefficient[index - 1])
-                {
-                    sum.integer_sign = sign::NEGATIVE;
-                    sum.coefficient = sum.radix_complement();
-                    break;
-                }
-                // remove the extra carry digit of 1 if a < b, due to radix complement
-                else if (int_a.coefficient[index - 1] < int_b.coefficient[index - 1])
-                {
-                    sum.shrink();
-                    sum.coefficient[sum.coefficient_size() - 1] = sum.coefficient[sum.coefficient_size() - 1] - 1;
-                    sum.shrink();
-                    break;
-                }
-            }
+            task_group group(big_int_thread_pool());
+            group.run(multiply_low);
+            group.run(multiply_high);
+            multiply_middle();
+            group.wait();
         }
-        // need to remove extra leading digit added by using radix complement since negative int is smaller
         else
         {
-            sum.shrink();
-            sum.coefficient[sum.coefficient_size() - 1] = sum.coefficient[sum.coefficient_size() - 1] - 1;
-            sum.shrink();
+            multiply_low();
+            multiply_high();
+            multiply_middle();
         }
+
+        // middle = a_low * b_high + a_high * b_low
+        subtract_digits(middle.data(), middle.size(), low.data(), low.size());
+        subtract_digits(middle.data(), middle.size(), high.data(), high.size());
+
+        // result = high * base^(2 * half) + middle * base^half + low, where middle may have leading zeros that do not fit
+        copy(low.begin(), low.end(), result);
+        copy(high.begin(), high.end(), result + 2 * half);
+        uint64_t middle_size = min((uint64_t)middle.size(), size - half);
+        add_digits(result + half, size - half, middle.data(), middle_size);
+    }
+}
+
+void big_int::add_product(const uint32_t *short_digits, const uint64_t &short_size, const uint32_t *long_digits, const uint64_t &long_size, const bool &product_negative)
+{
+    BIG_INT_COUNT_OPERATION(big_int_operation::MULTIPLY, long_size);
+
+    // Nothing to add if either integer is zero
+    if ((short_size == 1 && short_digits[0] == 0) || (long_size == 1 && long_digits[0] == 0))
+    {
+        return;
     }
-    // One int is positive and other is negative
-    else if (int_a.get_sign() == sign::POSITIVE && int_b.get_sign() == sign ::NEGATIVE)
+
+    // Zero takes the sign of the product
+    if (is_zero())
     {
-        // add a coefficient and radix of b
-        sum.coefficient = add_coefficients(int_a.coefficient, int_b.radix_complement());
+        integer_sign = product_negative ? sign::NEGATIVE : sign::POSITIVE;
+    }
 
-        /* update sum big int sign to negative if int_b is a bigger value
-           and update the sum digits to the radix complement (since result is negative and in radix complement)*/
-        if (int_a.coefficient_size() < int_b.coefficient_size())
+    // Large products are computed on their own with the Karatsuba method and then added with a multiplier of 1
+    if (short_size >= karatsuba_coefficients)
+    {
+        vector<uint32_t> product(short_size + long_size);
+        multiply_digits(product.data(), short_digits, short_size, long_digits, long_size);
+        if (is_zero())
         {
-            sum.integer_sign = sign::NEGATIVE;
-            sum.coefficient = sum.radix_complement();
+            coefficient = std::move(product);
+            normalize();
         }
-        else if (int_a.coefficient_size() == int_b.coefficient_size())
+        else
         {
-            uint64_t size = int_a.coefficient_size();
-            // Loop through each digit until find one that is bigger than the other, indicating which int is bigger overall
-            for (uint64_t index = size; index > 0; index--)
-            {
-                // set sign to negative and set digits to the radix complement
-                if (int_a.coefficient[index - 1] < int_b.coefficient[index - 1])
-                {
-                    sum.integer_sign = sign::NEGATIVE;
-                    sum.coefficient = sum.radix_complement();
-                    break;
-                }
-                // remove the extra carry digit of 1 if a < b, due to radix complement
-                else if (int_a.coefficient[index - 1] > int_b.coefficient[index - 1])
-                {
-                    sum.shrink();
-                    sum.coefficient[sum.coefficient_size() - 1] = sum.coefficient[sum.coefficient_size() - 1] - 1;
-                    sum.shrink();
-                    break;
-                }
-            }
+            const uint32_t one = 1;
+            add_product(&one, 1, product.data(), product.size(), product_negative);
         }
-        // need to remove extra leading digit added by using radix complement since negative int is smaller
-        else
+        return;
+    }
+
+    // Make room for the largest possible result plus one coefficient to detect a change of sign
+    uint64_t size = max((uint64_t)coefficient.size(), short_size + long_size) + 1;
+    coefficient.resize(size, 0);
+    uint32_t *digits = coefficient.data();
+
+    // Same sign, add each row of the product (a digit of one integer times the other integer) into the coefficients
+    if ((integer_sign == sign::NEGATIVE) == product_negative)
+    {
+        for (uint64_t i = 0; i < short_size; i++)
         {
-            sum.shrink();
-            sum.coefficient[sum.coefficient_size() - 1] = sum.coefficient[sum.coefficient_size() - 1] - 1;
-            sum.shrink();
+            uint64_t carry = add_multiple(digits + i, long_digits, long_size, short_digits[i]);
+            for (uint64_t k = i + long_size; carry != 0; k++)
+            {
+                uint64_t temp = digits[k] + carry;
+                digits[k] = (uint32_t)(temp & (uint64_t)UINT32_MAX);
+                carry = temp >> 32;
+            }
         }
     }
-    // both integers are positive case
+    // Different signs, subtract each row modulo base^size
     else
     {
-        // add the coefficients of both a and b, no need to change sign of sum
-        sum.coefficient = add_coefficients(int_a.coefficient, int_b.coefficient);
+        for (uint64_t i = 0; i < short_size; i++)
+        {
+            uint32_t borrow = subtract_multiple(digits + i, long_digits, long_size, short_digits[i]);
+            for (uint64_t k = i + long_size; borrow != 0 && k < size; k++)
+            {
+                uint32_t before = digits[k];
+                digits[k] = before - borrow;
+                borrow = before < borrow ? 1 : 0;
+            }
+        }
+
+        // The magnitude of the result is less than base^(size - 1), thus a non zero last coefficient means the
+        // product was bigger and the result is in radix complement form
+        if (digits[size - 1] != 0)
+        {
+            uint64_t carry = 1;
+            for (uint64_t k = 0; k < size; k++)
+            {
+                uint64_t temp = (uint64_t)(~digits[k]) + carry;
+                digits[k] = (uint32_t)(temp & (uint64_t)UINT32_MAX);
+                carry = temp >> 32;
+            }
+            negate();
+        }
     }
 
-    return sum;
+    normalize();
+}
+
+/******************************* Radix Conversion ******************************/
+string big_int_conversion::to_radix_string(const big_int &integer, const uint32_t &radix)
+{
+    BIG_INT_COUNT_OPERATION(big_int_operation::TO_STRING, integer.coefficient_size());
+
+    // The sign goes in the first character and the digits after it
+    string digits(digit_bound(integer, radix) + 1, '+');
+    if (is_negative(integer))
+    {
+        digits[0] = '-';
+    }
+    char *end = write_chars(integer, digits.data() + 1, digits.data() + digits.size(), radix);
+    digits.resize((uint64_t)(end - digits.data()));
+    return digits;
 }
 
-big_int operator-(const big_int &int_a, const big_int &int_b)
+big_int big_int_conversion::from_radix_string(const string &integer, const uint32_t &radix)
 {
-    return int_a + (-int_b);
+    BIG_INT_COUNT_OPERATION(big_int_operation::FROM_STRING, integer.size() * bit_width(radix) / 32 + 1);
+
+    // Check to see if 1st character is a "+" or "-" sign and skip it
+    uint64_t first = 0;
+    bool negative = false;
+    if (!integer.empty() && (integer[0] == '+' || integer[0] == '-'))
+    {
+        negative = integer[0] == '-';
+        first = 1;
+    }
+
+    return read_radix(integer.data() + first, integer.size() - first, radix, negative);
 }
 
-big_int operator*(const big_int &int_a, const big_int &int_b)
+char *big_int_conversion::write_chars(const big_int &integer, char *first, char *last, const uint32_t &radix)
 {
-    big_int product;
+    BIG_INT_COUNT_OPERATION(big_int_operation::TO_STRING, integer.coefficient_size());
 
-    // multiply each coefficient/digit of the multiplier (int_b) by each coefficient/digit of the multiplicand (int_a)
-    for (uint64_t i = 0; i < int_a.coefficient_size(); i++)
+    if (has_single_bit(radix))
     {
-        uint64_t carry = 0;
-        // multiply digit of int_a by each digit of int_b and add to the product big_int at index (i+j) if it exists
-        for (uint64_t j = 0; j < int_b.coefficient_size() && (i + j) < product.coefficient_size(); j++)
+        uint64_t count = bit_digits(integer, radix);
+        if ((uint64_t)(last - first) < count)
         {
-            uint64_t temp = (int_a.coefficient[i] * (uint64_t)int_b.coefficient[j]) + carry + product.coefficient[i + j];
-            product.coefficient[i + j] = (uint32_t)(temp & (uint64_t)(UINT32_MAX));
-            carry = temp >> 32;
+            return nullptr;
         }
-        // if the product big int coefficient vector is not long enough start adding new coefficients with the value product + carry
-        for (uint64_t k = product.coefficient_size(); k < int_b.coefficient_size(); k++)
+        write_bits(integer, first, count, radix);
+        return first + count;
+    }
+
+    uint32_t chunk = 0;
+    uint64_t chunk_digits = chunk_power(radix, chunk);
+
+    // The digits are written right aligned at the end of the buffer, then moved to its start
+    char *start = nullptr;
+    if (integer.coefficient_size() < conversion_coefficients)
+    {
+        start = write_leading_small(integer, first, last, radix, chunk, chunk_digits);
+    }
+    else
+    {
+        big_int magnitude(integer);
+        magnitude.integer_sign = sign::POSITIVE;
+
+        // Square the power until it is larger than the integer, each level splits the integer by the level below
+        vector<big_int> values = {big_int((int64_t)chunk)};
+        while (!(magnitude < values.back()))
         {
-            uint64_t temp = (int_a.coefficient[i] * (uint64_t)int_b.coefficient[k]) + carry;
-            product.coefficient.push_back((uint32_t)(temp & (uint64_t)(UINT32_MAX)));
-            carry = temp >> 32;
+            values.push_back(values.back() * values.back());
         }
+        uint64_t levels = values.size() - 1;
 
-        //add new coefficient with carry if any
-        if (carry != 0)
+        vector<radix_power> powers(levels);
+        for (uint64_t k = 0; k < levels; k++)
         {
-            product.coefficient.push_back((uint32_t)carry);
+            powers[k] = make_power(values[k]);
         }
+        start = write_leading(magnitude, values, powers, levels, first, last, radix, chunk, chunk_digits);
     }
 
-    // update the sign of the product big_int if only one of the two integers multiplied are negative
-    if (int_a.get_sign() == sign::NEGATIVE && int_b.get_sign() == sign::POSITIVE)
-    {
-        product.integer_sign = sign::NEGATIVE;
-    }
-    else if (int_a.get_sign() == sign::POSITIVE && int_b.get_sign() == sign ::NEGATIVE)
+    if (start == nullptr)
     {
-        product.integer_sign = sign::NEGATIVE;
+        return nullptr;
     }
-
-    return product;
+    uint64_t count = (uint64_t)(last - start);
+    memmove(first, start, count);
+    return first + count;
 }
 
-big_int operator/(const big_int &dividend, const big_int &divisor)
+uint64_t big_int_conversion::digit_bound(const big_int &integer, const uint32_t &radix)
 {
-    // check for division by zero and throw exception
-    if (divisor.at(0) == 0 && divisor.coefficient_size() == 1)
+    if (has_single_bit(radix))
     {
-        throw division_by_zero();
+        return bit_digits(integer, radix);
     }
 
-    big_int quotient;
-    big_int one(1);
-    uint64_t dividend_size = dividend.coefficient_size();
-    uint64_t divisor_size = divisor.coefficient_size();
-    // If dividend smaller return zero
-    if (dividend_size < divisor_size)
+    // An integer of b bits has at most floor(b * log(2) / log(radix)) + 1 digits, one more covers rounding
+    uint64_t size = integer.coefficient.size();
+    while (size > 1 && integer.coefficient[size - 1] == 0)
     {
-        return quotient;
+        size--;
     }
-    // if divisor equals 1
-    else if (divisor == one)
+    uint64_t bits = 32 * (size - 1) + (uint64_t)bit_width(integer.coefficient[size - 1]);
+    return (uint64_t)((double)bits * log(2.0) / log((double)radix)) + 2;
+}
+
+big_int big_int_conversion::read_radix(const char *in, const uint64_t &length, const uint32_t &radix, const bool &negative)
+{
+    BIG_INT_COUNT_OPERATION(big_int_operation::FROM_STRING, length * bit_width(radix) / 32 + 1);
+
+    uint32_t chunk = 0;
+    uint64_t chunk_digits = chunk_power(radix, chunk);
+    big_int result;
+    if (has_single_bit(radix))
     {
-        quotient = dividend;
-        return quotient;
+        result = read_bits(in, length, radix);
     }
-
-    // set the remainder big_int to the 1st divisor_size - 1 digits of the dividend
-    big_int remainder;
-    remainder.coefficient.erase(remainder.coefficient.begin());
-    for (uint64_t index = dividend_size - 1 - (divisor_size - 2); index < dividend_size; index++)
+    else if (length <= chunk_digits * conversion_coefficients)
     {
-        remainder.coefficient.push_back(dividend.coefficient[index]);
+        result = read_small(in, length, radix, chunk_digits);
     }
-
-    //Long Division as if two positive integers
-    for (uint64_t i = 0; i < dividend_size - divisor_size + 1; i++)
+    else
     {
-        //Add the next digit of the dividend as the least significant digit of the remainder
-        remainder.coefficient.insert(remainder.coefficient.begin(), dividend.coefficient[dividend_size - divisor_size - i]);
-
-        //Find the number to times the divisor can got into the remainder value (the count)
-        uint32_t count = 0;
-        // Account for negative divisor and the subtraction
-        if (divisor.get_sign() == sign::NEGATIVE)
-        {
-            big_int sub = remainder + divisor;
-            while (sub.get_sign() == sign::POSITIVE)
-            {
-                count++;
-                sub = sub + divisor;
-            }
-
-            remainder = sub - divisor;
-        }
-        // if divisor is positive, then do regular long division
-        else
+        // Square the power while a split by it still leaves high digits
+        vector<big_int> values = {big_int((int64_t)chunk)};
+        while ((chunk_digits << values.size()) < length)
         {
-            big_int sub = remainder - divisor;
-            while (sub.get_sign() == sign::POSITIVE)
-            {
-                count++;
-                sub = sub - divisor;
-            }
-
-            // Set remainder to be previous remainder - dividend*count
-            remainder = sub + divisor;
+            values.push_back(values.back() * values.back());
         }
+        result = read_digits(in, length, values, radix, chunk_digits);
+    }
 
-        // Add the count as the next least significant digit of the quotient
-        quotient.coefficient.insert(quotient.coefficient.begin(), count);
+    if (negative && !result.is_zero())
+    {
+        result.integer_sign = sign::NEGATIVE;
     }
+    return result;
+}
+
+bool big_int_conversion::is_negative(const big_int &integer)
+{
+    return integer.integer_sign == sign::NEGATIVE && any_of(integer.coefficient.begin(), integer.coefficient.end(), [](const uint32_t &digit)
+                                                              { return digit != 0; });
+}
 
-    // Update the sign of the quotient either divisor or divident is negative
-    if (dividend.get_sign() == sign::NEGATIVE && divisor.get_sign() == sign::POSITIVE)
+bool big_int_conversion::is_digit(const char &symbol, const uint32_t &radix)
+{
+    if (symbol >= '0' && symbol <= '9')
     {
-        quotient.integer_sign = sign::NEGATIVE;
+        return (uint32_t)(symbol - '0') < radix;
     }
-    else if (dividend.get_sign() == sign::POSITIVE && divisor.get_sign() == sign::NEGATIVE)
+    if (symbol >= 'a' && symbol <= 'z')
     {
-        quotient.integer_sign = sign::NEGATIVE;
+        return (uint32_t)(symbol - 'a') + 10 < radix;
     }
-
-    return quotient;
+    if (symbol >= 'A' && symbol <= 'Z')
+    {
+        return (uint32_t)(symbol - 'A') + 10 < radix;
+    }
+    return false;
 }
 
-// Referenced: https://www.cplusplus.com/reference/algorithm/reverse/
-string print_base10(const big_int &integer)
+uint64_t big_int_conversion::chunk_power(const uint32_t &radix, uint32_t &chunk)
 {
-    stringstream base10;
-    big_int copy(integer);
-
-    // Divide the big integer by 10 and the remainder is a digit of  the integer in base 10, until big integer is zero
-    do
+    chunk = radix;
+    uint64_t chunk_digits = 1;
+    while ((uint64_t)chunk * radix <= (uint64_t)UINT32_MAX)
     {
-        base10 << copy.remainder_32(10);
-        copy.divide_32(10);
-        copy.shrink(); // remove extra zeros
-    } while (copy.at(0) != 0);
+        chunk *= radix;
+        chunk_digits++;
+    }
+    return chunk_digits;
+}
 
-    // add sign of big integer to string
-    if (copy.get_sign() == sign::POSITIVE)
+big_int big_int_conversion::shift_left(const big_int &integer, const uint64_t &bits)
+{
+    uint64_t limbs = bits / 32;
+    uint32_t offset = (uint32_t)(bits % 32);
+    big_int shifted;
+    shifted.coefficient.assign(integer.coefficient_size() + limbs + 1, 0);
+    for (uint64_t i = 0; i < integer.coefficient_size(); i++)
     {
-        base10 << '+';
+        uint64_t temp = (uint64_t)integer.coefficient[i] << offset;
+        shifted.coefficient[i + limbs] |= (uint32_t)(temp & (uint64_t)UINT32_MAX);
+        shifted.coefficient[i + limbs + 1] = (uint32_t)(temp >> 32);
     }
-    else
+    shifted.integer_sign = integer.integer_sign;
+    shifted.normalize();
+    return shifted;
+}
+
+big_int big_int_conversion::shift_right(const big_int &integer, const uint64_t &bits)
+{
+    uint64_t limbs = bits / 32;
+    uint32_t offset = (uint32_t)(bits % 32);
+    big_int shifted;
+    if (limbs >= integer.coefficient_size())
     {
-        base10 << '-';
+        return shifted;
     }
 
-    // Referse the integer string since remainder starts producing from least significant digit
-    string int_reverse = base10.str();
-    reverse(int_reverse.begin(), int_reverse.end());
-
-    return int_reverse;
+    shifted.coefficient.resize(integer.coefficient_size() - limbs);
+    for (uint64_t i = 0; i < shifted.coefficient.size(); i++)
+    {
+        uint64_t temp = integer.coefficient[i + limbs];
+        if (i + limbs + 1 < integer.coefficient_size())
+        {
+            temp |= (uint64_t)integer.coefficient[i + limbs + 1] << 32;
+        }
+        shifted.coefficient[i] = (uint32_t)((temp >> offset) & (uint64_t)UINT32_MAX);
+    }
+    shifted.integer_sign = integer.integer_sign;
+    shifted.normalize();
+    return shifted;
 }
 
-/************************** Helper Functions and other Operator Overloads *************************/
-big_int operator-(const big_int &int_a)
+big_int big_int_conversion::power_of_base(const uint64_t &exponent)
 {
-    // Copy int a and use negate member function on the copy
-    big_int negation(int_a);
-    negation.negate();
-    return negation;
+    big_int power;
+    power.coefficient.assign(exponent + 1, 0);
+    power.coefficient[exponent] = 1;
+    return power;
 }
 
-bool operator<(const big_int &int_a, const big_int &int_b)
+vector<uint32_t> big_int_conversion::divide_digits(const vector<uint32_t> &dividend, const vector<uint32_t> &divisor)
 {
-    sign a_sign = int_a.get_sign();
-    sign b_sign = int_b.get_sign();
-    uint64_t a_size = int_a.coefficient_size();
-    uint64_t b_size = int_b.coefficient_size();
+    uint64_t m = dividend.size();
+    uint64_t n = divisor.size();
+    if (m < n)
+    {
+        return {0};
+    }
 
-    // Check if one int is negative and the other is positive
-    if (a_sign == sign::NEGATIVE && b_sign == sign::POSITIVE)
-        return true;
-    else if (int_a.get_sign() == sign::POSITIVE && int_b.get_sign() == sign::NEGATIVE)
-        return false;
+    vector<uint32_t> quotient(m - n + 1, 0);
+    uint32_t shift = (uint32_t)countl_zero(divisor[n - 1]);
 
-    // Since both ints have same sign, check if int a has more digits than b and return based on sign
-    else if (a_size < b_size)
+    // Shift both the divisor and dividend, the dividend gets one more coefficient
+    vector<uint32_t> v(n);
+    vector<uint32_t> u(m + 1);
+    for (uint64_t i = n; i > 0; i--)
     {
-        if (a_sign == sign::POSITIVE)
-            return true;
-        else
-            return false;
+        uint64_t temp = ((uint64_t)divisor[i - 1] << shift) | (i > 1 && shift != 0 ? divisor[i - 2] >> (32 - shift) : 0);
+        v[i - 1] = (uint32_t)(temp & (uint64_t)UINT32_MAX);
     }
-    else if (a_size > b_size)
+    u[m] = shift != 0 ? dividend[m - 1] >> (32 - shift) : 0;
+    for (uint64_t i = m; i > 0; i--)
     {
-        if (a_sign == sign::POSITIVE)
-            return false;
-        else
-            return true;
+        uint64_t temp = ((uint64_t)dividend[i - 1] << shift) | (i > 1 && shift != 0 ? dividend[i - 2] >> (32 - shift) : 0);
+        u[i - 1] = (uint32_t)(temp & (uint64_t)UINT32_MAX);
     }
 
-    // Both ints have same number of digits, starting with most significant, go digit by digit and compare
-    // If digits are the same move to next digit
-    bool flag = false;
-    bool same_value = true;
-    for (uint64_t i = a_size; i > 0; i--)
+    for (uint64_t j = m - n + 1; j > 0; j--)
     {
-        // Check if digit of a is < digit of b
-        if (int_a.at(i - 1) < int_b.at(i - 1))
+        uint64_t index = j - 1;
+
+        // Estimate the quotient digit from the leading digits
+        uint64_t numerator = ((uint64_t)u[index + n] << 32) | u[index + n - 1];
+        uint64_t estimate = numerator / v[n - 1];
+        uint64_t estimate_remainder = numerator % v[n - 1];
+        while (estimate > UINT32_MAX || (n > 1 && estimate * v[n - 2] > ((estimate_remainder << 32) | u[index + n - 2])))
         {
-            flag = true;
-            same_value = false;
-            break;
+            estimate--;
+            estimate_remainder += v[n - 1];
+            if (estimate_remainder > UINT32_MAX)
+            {
+                break;
+            }
         }
-        // Check if digit of a > digit of b
-        else if (int_a.at(i - 1) > int_b.at(i - 1))
+
+        // Subtract estimate * divisor from the current part of the dividend
+        uint32_t borrow = subtract_multiple(u.data() + index, v.data(), n, (uint32_t)estimate);
+        bool negative = u[index + n] < borrow;
+        u[index + n] = u[index + n] - borrow;
+
+        // The estimate was one too large, add the divisor back
+        if (negative)
         {
-            flag = false;
-            same_value = false;
-            break;
+            estimate--;
+            u[index + n] = u[index + n] + add_digits(u.data() + index, n, v.data(), n);
         }
+        quotient[index] = (uint32_t)estimate;
+    }
+    return quotient;
+}
+
+big_int big_int_conversion::reciprocal(const big_int &divisor)
+{
+    uint64_t n = divisor.coefficient_size();
+    big_int scale = power_of_base(2 * n);
+
+    big_int estimate;
+    if (n <= 16)
+    {
+        estimate.coefficient = divide_digits(scale.coefficient, divisor.coefficient);
+        estimate.normalize();
+        return estimate;
     }
 
-    // Check if both are negative
-    if (int_a.get_sign() == sign::NEGATIVE && int_b.get_sign() == sign::NEGATIVE && !same_value)
+    // The reciprocal of the leading half + 1 coefficients is accurate to about that many coefficients
+    uint64_t half = n / 2 + 1;
+    big_int leading = shift_right(divisor, 32 * (n - half));
+    estimate = shift_left(reciprocal(leading), 32 * (n - half));
+
+    big_int error = scale - divisor * estimate;
+    estimate += shift_right(estimate * error, 64 * n);
+
+    // Newton's method leaves the estimate within a few units of the reciprocal
+    big_int remainder = scale - divisor * estimate;
+    while (remainder.get_sign() == sign::NEGATIVE)
     {
-        return !flag;
+        estimate -= 1;
+        remainder += divisor;
     }
-    // Check if same value (both are positive)
-    else if (!same_value)
+    while (!(remainder < divisor))
     {
-        return flag;
+        estimate += 1;
+        remainder -= divisor;
     }
-    return false;
+    return estimate;
+}
+
+big_int_conversion::radix_power big_int_conversion::make_power(const big_int &power)
+{
+    radix_power prepared;
+    prepared.shift = (uint64_t)countl_zero(power.coefficient.back());
+    prepared.value = shift_left(power, prepared.shift);
+    prepared.size = prepared.value.coefficient_size();
+    prepared.reciprocal = reciprocal(prepared.value);
+    return prepared;
 }
 
-bool operator>(const big_int &int_a, const big_int &int_b)
+void big_int_conversion::divide_by_power(const big_int &dividend, const radix_power &power, big_int &quotient, big_int &remainder)
 {
-    return int_b < int_a;
+    // Divide with the shifted power, which has the same quotient when the dividend is shifted the same
+    big_int shifted = shift_left(dividend, power.shift);
+    big_int estimate = shift_right(shifted, 32 * (power.size - 1));
+    quotient = shift_right(estimate * power.reciprocal, 32 * (power.size + 1));
+
+    // The estimated quotient is at most 2 less than the quotient
+    remainder = shifted - quotient * power.value;
+    while (!(remainder < power.value))
+    {
+        remainder -= power.value;
+        quotient += 1;
+    }
+    remainder = shift_right(remainder, power.shift);
 }
 
-bool operator!=(const big_int &int_a, const big_int &int_b)
+big_int big_int_conversion::divide(const big_int &dividend, const big_int &divisor)
 {
-    // Check if each digit of both integers are the same value
-    for (uint64_t index = 0; index < int_a.coefficient_size(); index++)
+    // The vector constructor keeps leading zeros, the divisions need the most significant coefficient to be set
+    if (divisor.coefficient.back() == 0)
+    {
+        big_int trimmed(divisor);
+        trimmed.normalize();
+        if (trimmed.is_zero())
+        {
+            throw division_by_zero();
+        }
+        return divide(dividend, trimmed);
+    }
+
+    // Long division takes time proportional to the sizes of the divisor and the quotient, a short quotient (ie of
+    // integers of about the same size) is found faster by long division whatever the size of the divisor
+    big_int quotient;
+    uint64_t n = divisor.coefficient.size();
+    uint64_t m = dividend.coefficient.size();
+    if (n >= division_coefficients && m >= n && m - n + 1 >= division_coefficients)
     {
-        if (int_a.at(index) != int_b.at(index))
-            return true;
+        return divide_barrett(dividend, divisor);
     }
+    quotient.coefficient = divide_digits(dividend.coefficient, divisor.coefficient);
+    quotient.normalize();
+    return quotient;
+}
+
+big_int big_int_conversion::divide_barrett(const big_int &dividend, const big_int &divisor)
+{
+    big_int magnitude(divisor);
+    magnitude.integer_sign = sign::POSITIVE;
+    radix_power power = make_power(magnitude);
 
-    // Since both ints are the same check for different signs
-    if (int_a.get_sign() != int_b.get_sign())
-        return true;
+    uint64_t n = divisor.coefficient.size();
+    uint64_t m = dividend.coefficient.size();
+    uint64_t blocks = (m + n - 1) / n;
+    big_int quotient;
+    quotient.coefficient.assign(blocks * n, 0);
 
-    return false;
+    // Each part is the remainder so far followed by the next n coefficients, it is less than divisor * base^n
+    big_int remainder;
+    for (uint64_t block = blocks; block > 0; block--)
+    {
+        uint64_t low = (block - 1) * n;
+        uint64_t high = min(low + n, m);
+        big_int part = shift_left(remainder, 32 * n);
+        part.coefficient.resize(max(part.coefficient.size(), high - low), 0);
+        copy(dividend.coefficient.begin() + (int64_t)low, dividend.coefficient.begin() + (int64_t)high, part.coefficient.begin());
+        part.integer_sign = sign::POSITIVE;
+        part.normalize();
+
+        big_int part_quotient;
+        divide_by_power(part, power, part_quotient, remainder);
+        copy(part_quotient.coefficient.begin(), part_quotient.coefficient.end(), quotient.coefficient.begin() + (int64_t)low);
+    }
+    quotient.normalize();
+    return quotient;
 }
 
-bool operator==(const big_int &int_a, const big_int &int_b)
+void big_int_conversion::write_small(const big_int &integer, char *out, const uint64_t &width, const uint32_t &radix, const uint32_t &chunk, const uint64_t &chunk_digits)
 {
-    return !(int_a != int_b);
+    static const char symbols[] = "0123456789abcdefghijklmnopqrstuvwxyz";
+    vector<uint32_t> digits = integer.coefficient;
+    uint64_t size = digits.size();
+    uint64_t position = width;
+
+    while (size > 0 && position > 0 && !(size == 1 && digits[0] == 0))
+    {
+        // Divide by chunk, the remainder holds the next chunk_digits digits
+        uint64_t remainder = 0;
+        for (uint64_t i = size; i > 0; i--)
+        {
+            uint64_t temp = (remainder << 32) | digits[i - 1];
+            digits[i - 1] = (uint32_t)(temp / chunk);
+            remainder = temp % chunk;
+        }
+        while (size > 1 && digits[size - 1] == 0)
+        {
+            size--;
+        }
+
+        for (uint64_t d = 0; d < chunk_digits && position > 0; d++)
+        {
+            out[--position] = symbols[remainder % radix];
+            remainder = remainder / radix;
+        }
+    }
+
+    fill(out, out + position, '0');
 }
 
+void big_int_conversion::write_digits(const big_int &integer, const vector<radix_power> &powers, const uint64_t &level, char *out, const uint32_t &radix, const uint32_t &chunk, const uint64_t &chunk_digits)
+{
+    uint64_t width = chunk_digits << level;
+    if (integer.is_zero())
+    {
+        fill(out, out + width, '0');
+        return;
+    }
+    if (level == 0 || integer.coefficient_size() < conversion_coefficients)
+    {
+        write_small(integer, out, width, radix, chunk, chunk_digits);
+        return;
+    }
+
+    // The high half goes in the first half of the characters and the low half in the second half
+    big_int high;
+    big_int low;
+    divide_by_power(integer, powers[level - 1], high, low);
+    uint64_t lower = level - 1;
+    uint64_t half = width / 2;
+
+    if (integer.coefficient_size() >= parallel_conversion_coefficients && big_int_thread_pool().size() > 1)
+    {
+        task_group group(big_int_thread_pool());
+        group.run([&]
+                  { write_digits(high, powers, lower, out, radix, chunk, chunk_digits); });
+        write_digits(low, powers, lower, out + half, radix, chunk, chunk_digits);
+        group.wait();
+    }
+    else
+    {
+        write_digits(high, powers, lower, out, radix, chunk, chunk_digits);
+        write_digits(low, powers, lower, out + half, radix, chunk, chunk_digits);
+    }
+}
+
+char *big_int_conversion::write_leading_small(const big_int &integer, char *limit, char *end, const uint32_t &radix, const uint32_t &chunk, const uint64_t &chunk_digits)
+{
+    static const char symbols[] = "0123456789abcdefghijklmnopqrstuvwxyz";
+
+    // Copy the coefficients for the division, to the stack if they fit
+    uint64_t size = integer.coefficient.size();
+    array<uint32_t, 64> local;
+    vector<uint32_t> heap;
+    uint32_t *digits = local.data();
+    if (size > local.size())
+    {
+        heap = integer.coefficient;
+        digits = heap.data();
+    }
+    else
+    {
+        copy(integer.coefficient.begin(), integer.coefficient.end(), digits);
+    }
+
+    char *position = end;
+    bool last_chunk = false;
+    while (!last_chunk)
+    {
+        // Divide by chunk, the remainder holds the next chunk_digits digits
+        uint64_t remainder = 0;
+        for (uint64_t i = size; i > 0; i--)
+        {
+            uint64_t temp = (remainder << 32) | digits[i - 1];
+            digits[i - 1] = (uint32_t)(temp / chunk);
+            remainder = temp % chunk;
+        }
+        while (size > 1 && digits[size - 1] == 0)
+        {
+            size--;
+        }
+
+        // The last chunk has no leading zeros
+        last_chunk = size == 1 && digits[0] == 0;
+        for (uint64_t d = 0; d < chunk_digits && (!last_chunk || remainder != 0); d++)
+        {
+            if (position == limit)
+            {
+                return nullptr;
+            }
+            *--position = symbols[remainder % radix];
+            remainder = remainder / radix;
+        }
+    }
+
+    // Zero has a single digit
+    if (position == end)
+    {
+        if (position == limit)
+        {
+            return nullptr;
+        }
+        *--position = '0';
+    }
+    return position;
+}
+
+char *big_int_conversion::write_leading(const big_int &integer, const vector<big_int> &values, const vector<radix_power> &powers, const uint64_t &level, char *limit, char *end, const uint32_t &radix, const uint32_t &chunk, const uint64_t &chunk_digits)
+{
+    if (level == 0 || integer.coefficient_size() < conversion_coefficients)
+    {
+        return write_leading_small(integer, limit, end, radix, chunk, chunk_digits);
+    }
+    if (integer < values[level - 1])
+    {
+        return write_leading(integer, values, powers, level - 1, limit, end, radix, chunk, chunk_digits);
+    }
+
+    // The low half has exactly width digits before end, the high half is written before it without leading zeros
+    uint64_t lower = level - 1;
+    uint64_t width = chunk_digits << lower;
+    if ((uint64_t)(end - limit) < width)
+    {
+        return nullptr;
+    }
+    big_int high;
+    big_int low;
+    divide_by_power(integer, powers[lower], high, low);
+
+    char *start = nullptr;
+    if (integer.coefficient_size() >= parallel_conversion_coefficients && big_int_thread_pool().size() > 1)
+    {
+        task_group group(big_int_thread_pool());
+        group.run([&]
+                  { write_digits(low, powers, lower, end - width, radix, chunk, chunk_digits); });
+        start = write_leading(high, values, powers, lower, limit, end - width, radix, chunk, chunk_digits);
+        group.wait();
+    }
+    else
+    {
+        write_digits(low, powers, lower, end - width, radix, chunk, chunk_digits);
+        start = write_leading(high, values, powers, lower, limit, end - width, radix, chunk, chunk_digits);
+    }
+    return start;
+}
+
+void big_int_conversion::stream_radix(const big_int &integer, const uint32_t &radix, const function<void(const char *, const uint64_t &)> &sink)
+{
+    BIG_INT_COUNT_OPERATION(big_int_operation::TO_STRING, integer.coefficient_size());
+
+    big_int magnitude(integer);
+    magnitude.integer_sign = sign::POSITIVE;
+    magnitude.normalize();
+
+    digit_stream stream{{}, {}, radix, 0, 0, string(stream_chunk_size, '0'), 0, sink};
+    stream.chunk_digits = chunk_power(radix, stream.chunk);
+    stream.buffer[stream.used++] = is_negative(integer) ? '-' : '+';
+
+    // Square the power until it is larger than the integer, only the powers below the size of a chunk are prepared
+    stream.values.push_back(big_int((int64_t)stream.chunk));
+    while (!(magnitude < stream.values.back()))
+    {
+        stream.values.push_back(stream.values.back() * stream.values.back());
+    }
+    uint64_t levels = stream.values.size() - 1;
+    for (uint64_t k = 0; k < levels; k++)
+    {
+        stream.powers.push_back(make_power(stream.values[k]));
+    }
+
+    stream_leading(magnitude, levels, stream);
+    flush_stream(stream);
+}
+
+void big_int_conversion::flush_stream(digit_stream &stream)
+{
+    if (stream.used > 0)
+    {
+        stream.sink(stream.buffer.data(), stream.used);
+        stream.used = 0;
+    }
+}
+
+void big_int_conversion::stream_leading(const big_int &integer, const uint64_t &level, digit_stream &stream)
+{
+    if (level > 0 && integer < stream.values[level - 1])
+    {
+        stream_leading(integer, level - 1, stream);
+        return;
+    }
+
+    // The digits fit in a chunk, write them right aligned in the free part of the buffer and move them after the digits before
+    uint64_t width = stream.chunk_digits << level;
+    if (width <= stream.buffer.size())
+    {
+        if (stream.buffer.size() - stream.used < width)
+        {
+            flush_stream(stream);
+        }
+        char *first = stream.buffer.data() + stream.used;
+        char *last = stream.buffer.data() + stream.buffer.size();
+        char *start = write_leading(integer, stream.values, stream.powers, level, first, last, stream.radix, stream.chunk, stream.chunk_digits);
+        uint64_t count = (uint64_t)(last - start);
+        memmove(first, start, count);
+        stream.used += count;
+        return;
+    }
+
+    big_int high;
+    big_int low;
+    divide_by_power(integer, stream.powers[level - 1], high, low);
+    stream_leading(high, level - 1, stream);
+    stream_digits(low, level - 1, stream);
+}
+
+void big_int_conversion::stream_digits(const big_int &integer, const uint64_t &level, digit_stream &stream)
+{
+    uint64_t width = stream.chunk_digits << level;
+    if (width <= stream.buffer.size())
+    {
+        if (stream.buffer.size() - stream.used < width)
+        {
+            flush_stream(stream);
+        }
+        write_digits(integer, stream.powers, level, stream.buffer.data() + stream.used, stream.radix, stream.chunk, stream.chunk_digits);
+        stream.used += width;
+        return;
+    }
+
+    big_int high;
+    big_int low;
+    divide_by_power(integer, stream.powers[level - 1], high, low);
+    stream_digits(high, level - 1, stream);
+    stream_digits(low, level - 1, stream);
+}
+
+uint32_t big_int_conversion::digit_value(const char &symbol, const uint32_t &radix)
+{
+    uint32_t value = radix;
+    if (symbol >= '0' && symbol <= '9')
+    {
+        value = (uint32_t)(symbol - '0');
+    }
+    else if (symbol >= 'a' && symbol <= 'z')
+    {
+        value = (uint32_t)(symbol - 'a') + 10;
+    }
+    else if (symbol >= 'A' && symbol <= 'Z')
+    {
+        value = (uint32_t)(symbol - 'A') + 10;
+    }
+
+    if (value >= radix)
+    {
+        throw invalid_string_integer();
+    }
+    return value;
+}
+
+big_int big_int_conversion::read_small(const char *in, const uint64_t &length, const uint32_t &radix, const uint64_t &chunk_digits)
+{
+    big_int integer;
+    integer.coefficient.reserve(length / chunk_digits + 1);
+
+    // The first chunk holds the leftover digits so every other chunk has exactly chunk_digits digits
+    uint64_t position = 0;
+    uint64_t size = length % chunk_digits == 0 ? chunk_digits : length % chunk_digits;
+    while (position < length)
+    {
+        uint32_t value = 0;
+        uint32_t multiplier = 1;
+        for (uint64_t d = 0; d < size; d++)
+        {
+            value = value * radix + digit_value(in[position + d], radix);
+            multiplier *= radix;
+        }
+        integer.multiply_32(multiplier);
+        integer.add_32(value);
+        position += size;
+        size = chunk_digits;
+    }
+    integer.normalize();
+    return integer;
+}
+
+void big_int_conversion::write_bits(const big_int &integer, char *out, const uint64_t &count, const uint32_t &radix)
+{
+    static const char symbols[] = "0123456789abcdefghijklmnopqrstuvwxyz";
+    const vector<uint32_t> &digits = integer.coefficient;
+    uint64_t size = digits.size();
+    uint64_t bits = (uint64_t)bit_width(radix) - 1;
+
+    // Digit k holds bits k * bits to (k + 1) * bits - 1, which may continue into the next coefficient
+    for (uint64_t k = 0; k < count; k++)
+    {
+        uint64_t position = k * bits;
+        uint64_t index = position / 32;
+        uint64_t offset = position % 32;
+        uint64_t value = digits[index] >> offset;
+        if (offset + bits > 32 && index + 1 < size)
+        {
+            value |= (uint64_t)digits[index + 1] << (32 - offset);
+        }
+        out[count - 1 - k] = symbols[value & (radix - 1)];
+    }
+}
+
+uint64_t big_int_conversion::bit_digits(const big_int &integer, const uint32_t &radix)
+{
+    uint64_t size = integer.coefficient.size();
+    while (size > 1 && integer.coefficient[size - 1] == 0)
+    {
+        size--;
+    }
+    uint64_t bits = (uint64_t)bit_width(radix) - 1;
+    uint64_t total_bits = 32 * (size - 1) + (uint64_t)bit_width(integer.coefficient[size - 1]);
+    return max((total_bits + bits - 1) / bits, (uint64_t)1);
+}
+
+big_int big_int_conversion::read_bits(const char *in, const uint64_t &length, const uint32_t &radix)
+{
+    uint64_t bits = (uint64_t)bit_width(radix) - 1;
+    big_int integer;
+    integer.coefficient.assign(max((length * bits + 31) / 32, (uint64_t)1), 0);
+
+    // The last character is digit 0, its bits are the least significant
+    for (uint64_t k = 0; k < length; k++)
+    {
+        uint64_t value = digit_value(in[length - 1 - k], radix);
+        uint64_t position = k * bits;
+        uint64_t index = position / 32;
+        uint64_t offset = position % 32;
+        integer.coefficient[index] |= (uint32_t)(value << offset);
+        if (offset + bits > 32)
+        {
+            integer.coefficient[index + 1] |= (uint32_t)(value >> (32 - offset));
+        }
+    }
+    integer.normalize();
+    return integer;
+}
+
+big_int big_int_conversion::read_digits(const char *in, const uint64_t &length, const vector<big_int> &values, const uint32_t &radix, const uint64_t &chunk_digits)
+{
+    if (length <= chunk_digits * conversion_coefficients)
+    {
+        return read_small(in, length, radix, chunk_digits);
+    }
+
+    // Split off the largest power that leaves high digits, the low digits are its chunk_digits * 2^level digits
+    uint64_t level = 0;
+    while (level + 1 < values.size() && (chunk_digits << (level + 1)) < length)
+    {
+        level++;
+    }
+    uint64_t low_length = chunk_digits << level;
+    uint64_t high_length = length - low_length;
+
+    big_int high;
+    big_int low;
+    if (length >= chunk_digits * parallel_conversion_coefficients && big_int_thread_pool().size() > 1)
+    {
+        task_group group(big_int_thread_pool());
+        group.run([&]
+                  { high = read_digits(in, high_length, values, radix, chunk_digits); });
+        low = read_digits(in + high_length, low_length, values, radix, chunk_digits);
+        group.wait();
+    }
+    else
+    {
+        high = read_digits(in, high_length, values, radix, chunk_digits);
+        low = read_digits(in + high_length, low_length, values, radix, chunk_digits);
+    }
+
+    return high * values[level] + low;
+}
+
+/******************************* Friend Functions ******************************/
+
+void linear_combination(big_int &result, const big_int_term *terms, const uint64_t &count)
+{
+    // An expression of only products starts from zero, which is not counted as a sum
+    if (count == 0)
+    {
+        result.coefficient.assign(1, 0);
+        result.integer_sign = sign::POSITIVE;
+        return;
+    }
+
+    // The sum has as many coefficients as the largest term (plus a possible carry)
+    uint64_t size = 1;
+    for (uint64_t t = 0; t < count; t++)
+    {
+        size = max(size, terms[t].value->coefficient_size());
+    }
+    BIG_INT_COUNT_OPERATION(big_int_operation::ADD, size);
+
+    // Add the coefficients at each index of every term in one pass, the carry is signed since terms can be subtracted
+    vector<uint32_t> sum(size);
+    int64_t carry = 0;
+    for (uint64_t i = 0; i < size; i++)
+    {
+        int64_t column = carry;
+        for (uint64_t t = 0; t < count; t++)
+        {
+            const big_int &term = *terms[t].value;
+            if (i < term.coefficient.size())
+            {
+                // subtract the coefficient if exactly one of the subtract flag and the sign of the term is negative
+                if (terms[t].subtract != (term.integer_sign == sign::NEGATIVE))
+                    column -= term.coefficient[i];
+                else
+                    column += term.coefficient[i];
+            }
+        }
+        sum[i] = (uint32_t)(column & (int64_t)UINT32_MAX); // keep the low 32 bits
+        carry = column >> 32;                              // arithmetic shift keeps the sign of the carry
+    }
+
+    result.integer_sign = sign::POSITIVE;
+    if (carry > 0)
+    {
+        sum.push_back((uint32_t)carry);
+    }
+    // A negative carry means the sum is negative and the coefficients are in radix complement form
+    else if (carry < 0)
+    {
+        result.integer_sign = sign::NEGATIVE;
+
+        // The value is sum - high * base^size, thus its magnitude is (high - 1) * base^size + radix complement of sum
+        uint64_t high = (uint64_t)(-carry);
+        uint64_t complement_carry = 1;
+        for (uint32_t &digit : sum)
+        {
+            uint64_t temp = (uint64_t)(~digit) + complement_carry;
+            digit = (uint32_t)(temp & (uint64_t)UINT32_MAX);
+            complement_carry = temp >> 32;
+        }
+        high = high - 1 + complement_carry;
+        if (high != 0)
+        {
+            sum.push_back((uint32_t)high);
+        }
+    }
+
+    result.coefficient = std::move(sum);
+    result.normalize();
+}
+
+void addmul(big_int &accumulator, const big_int &int_a, const big_int &int_b)
+{
+    // The coefficients of the accumulator are updated in place, thus copy an operand that is the accumulator
+    if (&accumulator == &int_a || &accumulator == &int_b)
+    {
+        big_int copy(accumulator);
+        addmul(accumulator, &int_a == &accumulator ? copy : int_a, &int_b == &accumulator ? copy : int_b);
+        return;
+    }
+
+    // Go through the integer with fewer digits in the outer loop
+    const big_int &short_int = int_a.coefficient_size() <= int_b.coefficient_size() ? int_a : int_b;
+    const big_int &long_int = int_a.coefficient_size() <= int_b.coefficient_size() ? int_b : int_a;
+    bool product_negative = short_int.get_sign() != long_int.get_sign();
+    accumulator.add_product(short_int.coefficient.data(), short_int.coefficient_size(), long_int.coefficient.data(), long_int.coefficient_size(), product_negative);
+}
+
+void submul(big_int &accumulator, const big_int &int_a, const big_int &int_b)
+{
+    if (&accumulator == &int_a || &accumulator == &int_b)
+    {
+        big_int copy(accumulator);
+        submul(accumulator, &int_a == &accumulator ? copy : int_a, &int_b == &accumulator ? copy : int_b);
+        return;
+    }
+
+    // Subtracting the product is adding the product with the opposite sign
+    const big_int &short_int = int_a.coefficient_size() <= int_b.coefficient_size() ? int_a : int_b;
+    const big_int &long_int = int_a.coefficient_size() <= int_b.coefficient_size() ? int_b : int_a;
+    bool product_negative = short_int.get_sign() == long_int.get_sign();
+    accumulator.add_product(short_int.coefficient.data(), short_int.coefficient_size(), long_int.coefficient.data(), long_int.coefficient_size(), product_negative);
+}
+
+void addmul_1(big_int &accumulator, const big_int &int_a, const uint32_t &multiplier)
+{
+    if (&accumulator == &int_a)
+    {
+        big_int copy(accumulator);
+        addmul_1(accumulator, copy, multiplier);
+        return;
+    }
+
+    accumulator.add_product(&multiplier, 1, int_a.coefficient.data(), int_a.coefficient_size(), int_a.get_sign() == sign::NEGATIVE);
+}
+
+void submul_1(big_int &accumulator, const big_int &int_a, const uint32_t &multiplier)
+{
+    if (&accumulator == &int_a)
+    {
+        big_int copy(accumulator);
+        submul_1(accumulator, copy, multiplier);
+        return;
+    }
+
+    accumulator.add_product(&multiplier, 1, int_a.coefficient.data(), int_a.coefficient_size(), int_a.get_sign() == sign::POSITIVE);
+}
+
+big_int operator/(const big_int &dividend, const big_int &divisor)
+{
+    BIG_INT_COUNT_OPERATION(big_int_operation::DIVIDE, max(dividend.coefficient_size(), divisor.coefficient_size()));
+
+    // check for division by zero and throw exception
+    if (divisor.is_zero())
+    {
+        throw division_by_zero();
+    }
+
+    // Divide as if two positive integers, the quotient is negative if the signs differ
+    big_int quotient = big_int_conversion::divide(dividend, divisor);
+    if (dividend.get_sign() != divisor.get_sign() && !quotient.is_zero())
+    {
+        quotient.integer_sign = sign::NEGATIVE;
+    }
+    return quotient;
+}
+
+void big_int_native::divide(big_int &integer, const uint64_t &value_magnitude, const bool &value_negative)
+{
+    BIG_INT_COUNT_OPERATION(big_int_operation::DIVIDE, integer.coefficient_size());
+
+    if (value_magnitude == 0)
+    {
+        throw division_by_zero();
+    }
+
+    // A divisor of one coefficient is divided in place in a single pass, a larger one with the division of big integers
+    bool quotient_negative = (integer.integer_sign == sign::NEGATIVE) != value_negative;
+    if (value_magnitude <= UINT32_MAX)
+    {
+        integer.divide_32((uint32_t)value_magnitude);
+    }
+    else
+    {
+        big_int divisor(vector<uint32_t>{(uint32_t)(value_magnitude >> 32), (uint32_t)value_magnitude});
+        integer = big_int_conversion::divide(integer, divisor);
+    }
+    integer.integer_sign = quotient_negative ? sign::NEGATIVE : sign::POSITIVE;
+    integer.normalize();
+}
+
+void big_int_native::remainder(big_int &integer, const uint64_t &value_magnitude)
+{
+    BIG_INT_COUNT_OPERATION(big_int_operation::DIVIDE, integer.coefficient_size());
+
+    if (value_magnitude == 0)
+    {
+        throw division_by_zero();
+    }
+
+    // The remainder keeps the sign of the dividend, thus only its magnitude changes
+    if (value_magnitude <= UINT32_MAX)
+    {
+        integer.coefficient.assign(1, integer.remainder_32((uint32_t)value_magnitude));
+    }
+    else
+    {
+        sign integer_sign = integer.integer_sign;
+        big_int divisor(vector<uint32_t>{(uint32_t)(value_magnitude >> 32), (uint32_t)value_magnitude});
+        big_int quotient = big_int_conversion::divide(integer, divisor);
+        integer.integer_sign = sign::POSITIVE;
+        integer -= quotient * divisor;
+        integer.integer_sign = integer_sign;
+    }
+    integer.normalize();
+}
+
+big_int big_int_native::remainder_of(const big_int &dividend, const uint64_t &value_magnitude)
+{
+    // A remainder of one coefficient is found without copying the dividend
+    if (value_magnitude == 0 || value_magnitude > UINT32_MAX)
+    {
+        big_int result(dividend);
+        remainder(result, value_magnitude);
+        return result;
+    }
+    BIG_INT_COUNT_OPERATION(big_int_operation::DIVIDE, dividend.coefficient_size());
+    uint32_t remainder = dividend.remainder_32((uint32_t)value_magnitude);
+    return big_int(vector<uint32_t>(1, remainder), remainder == 0 ? sign::POSITIVE : dividend.integer_sign);
+}
+
+string print_base10(const big_int &integer)
+{
+    return big_int_conversion::to_radix_string(integer, 10);
+}
+
+/************************** Conversion to and from Buffers *************************/
+to_chars_result to_chars(char *first, char *last, const big_int &integer, const uint32_t &radix)
+{
+    if (radix < 2 || radix > 36)
+    {
+        return {last, errc::invalid_argument};
+    }
+
+    char *digits = first;
+    if (big_int_conversion::is_negative(integer))
+    {
+        if (first == last)
+        {
+            return {last, errc::value_too_large};
+        }
+        *digits++ = '-';
+    }
+    char *end = big_int_conversion::write_chars(integer, digits, last, radix);
+    if (end == nullptr)
+    {
+        return {last, errc::value_too_large};
+    }
+    return {end, errc()};
+}
+
+from_chars_result from_chars(const char *first, const char *last, big_int &integer, const uint32_t &radix)
+{
+    if (radix < 2 || radix > 36)
+    {
+        return {first, errc::invalid_argument};
+    }
+
+    const char *digits = first;
+    bool negative = false;
+    if (digits != last && (*digits == '+' || *digits == '-'))
+    {
+        negative = *digits == '-';
+        digits++;
+    }
+    const char *end = digits;
+    while (end != last && big_int_conversion::is_digit(*end, radix))
+    {
+        end++;
+    }
+    if (end == digits)
+    {
+        return {first, errc::invalid_argument};
+    }
+
+    integer = big_int_conversion::read_radix(digits, (uint64_t)(end - digits), radix, negative);
+    return {end, errc()};
+}
+
+uint64_t to_chars_size(const big_int &integer, const uint32_t &radix)
+{
+    return big_int_conversion::digit_bound(integer, radix) + (big_int_conversion::is_negative(integer) ? 1 : 0);
+}
+
+/************************** Streaming Output *************************/
+void stream_base10(const big_int &integer, const function<void(const char *, const uint64_t &)> &sink)
+{
+    big_int_conversion::stream_radix(integer, 10, sink);
+}
+
+void write_base10(ostream &out, const big_int &integer)
+{
+    big_int_conversion::stream_radix(integer, 10, [&](const char *digits, const uint64_t &count)
+                                     { out.write(digits, (streamsize)count); });
+}
+
+/************************** Algorithm Settings *************************/
+void set_karatsuba_threshold(const uint64_t &coefficients)
+{
+    // The halves of fewer than 4 coefficients would not get smaller
+    karatsuba_coefficients = max(coefficients, (uint64_t)4);
+}
+
+uint64_t karatsuba_threshold()
+{
+    return karatsuba_coefficients;
+}
+
+void set_parallel_multiply_threshold(const uint64_t &coefficients)
+{
+    parallel_multiply_coefficients = coefficients;
+}
+
+uint64_t parallel_multiply_threshold()
+{
+    return parallel_multiply_coefficients;
+}
+
+void set_division_threshold(const uint64_t &coefficients)
+{
+    division_coefficients = max(coefficients, (uint64_t)1);
+}
+
+uint64_t division_threshold()
+{
+    return division_coefficients;
+}
+
+void set_conversion_threshold(const uint64_t &coefficients)
+{
+    conversion_coefficients = max(coefficients, (uint64_t)2);
+}
+
+uint64_t conversion_threshold()
+{
+    return conversion_coefficients;
+}
+
+void set_parallel_conversion_threshold(const uint64_t &coefficients)
+{
+    parallel_conversion_coefficients = coefficients;
+}
+
+uint64_t parallel_conversion_threshold()
+{
+    return parallel_conversion_coefficients;
+}
+
+/************************** Helper Functions and other Operator Overloads *************************/
+
 vector<uint32_t> add_coefficients(const vector<uint32_t> &vec1, const vector<uint32_t> &vec2)
 {
     vector<uint32_t> sum;
@@ -11,8 +11,30 @@
 #include <vector>
 #include <string>
 #include <cstdint>
+#include <charconv>
+#include <functional>
+#include <compare>
+#include <algorithm>
+#include <new>
 using namespace std;
 
+class big_int;
+
+template <class E>
+class big_int_expr;
+
+/**
+ * @brief A term of a signed sum of big integers, used when evaluating chains of additions and subtractions
+ */
+struct big_int_term
+{
+    // The big_int being added
+    const big_int *value;
+
+    // True if the big_int is subtracted from the sum instead of added
+    bool subtract;
+};
+
 /**
  * @brief This enum class will be used to indicate whetHer a big_int is positive or negative
  */
@@ -29,28 +51,81 @@ class big_int
 {
     /*************************** Friend Functions ************************/
     /**
-     * @brief A friend function that adds two big integers
-     * @param int_a The first big_int to be added
-     * @param int_b The second big_int to be added
-     * @return A big_int that represents the sum of the two big_ints added
+     * @brief A friend function that evaluates a signed sum of big integers in a single pass over the coefficients
+     * @details Kernel used by the expression templates for chains of additions, subtractions and negations
+     * @param result The big_int that will hold the value of the sum
+     * @param terms The big_ints to sum along with whether each one is subtracted
+     * @param count The number of terms
+     */
+    friend void linear_combination(big_int &result, const big_int_term *terms, const uint64_t &count);
+
+    /**
+     * @brief A friend function that adds the product of two big integers directly into the coefficients of an accumulator (accumulator += int_a * int_b)
+     * @details No big_int is created for the product
+     * @param accumulator The big_int the product is added to
+     * @param int_a The first big_int to be multiplied
+     * @param int_b The second big_int to be multiplied
+     */
+    friend void addmul(big_int &accumulator, const big_int &int_a, const big_int &int_b);
+
+    /**
+     * @brief A friend function that subtracts the product of two big integers directly from the coefficients of an accumulator (accumulator -= int_a * int_b)
+     * @details No big_int is created for the product
+     * @param accumulator The big_int the product is subtracted from
+     * @param int_a The first big_int to be multiplied
+     * @param int_b The second big_int to be multiplied
+     */
+    friend void submul(big_int &accumulator, const big_int &int_a, const big_int &int_b);
+
+    /**
+     * @brief A friend function that adds the product of a big integer and an unsigned 32 bit integer directly into the coefficients of an accumulator (accumulator += int_a * multiplier)
+     * @param accumulator The big_int the product is added to
+     * @param int_a The big_int to be multiplied
+     * @param multiplier a 32 bit integer
+     */
+    friend void addmul_1(big_int &accumulator, const big_int &int_a, const uint32_t &multiplier);
+
+    /**
+     * @brief A friend function that subtracts the product of a big integer and an unsigned 32 bit integer directly from the coefficients of an accumulator (accumulator -= int_a * multiplier)
+     * @param accumulator The big_int the product is subtracted from
+     * @param int_a The big_int to be multiplied
+     * @param multiplier a 32 bit integer
      */
-    friend big_int operator+(const big_int &int_a, const big_int &int_b);
+    friend void submul_1(big_int &accumulator, const big_int &int_a, const uint32_t &multiplier);
 
     /**
-     * @brief A friend function that subtracts two big integers
-     * @param int_a The first big_int to be subtracted from
-     * @param int_b The second big_int to subtract from the first
-     * @return A big_int that represents the result of the subtraction of the two big_ints
+     * @brief A friend function that adds or subtracts a big integer in a constant expression (result += term or result -= term)
+     * @details Used by the expression templates instead of linear_combination when the compiler evaluates the expression
+     * @param result The big_int the term is added to
+     * @param term The big_int to add
+     * @param subtract True if the term is subtracted instead of added
      */
-    friend big_int operator-(const big_int &int_a, const big_int &int_b);
+    friend constexpr void constant_add(big_int &result, const big_int &term, const bool &subtract);
 
     /**
-     * @brief A friend function that multiplies two big integers
+     * @brief A friend function that adds or subtracts the product of two big integers in a constant expression (result += int_a * int_b)
+     * @details Used by the expression templates instead of addmul and submul when the compiler evaluates the expression
+     * @param result The big_int the product is added to
      * @param int_a The first big_int to be multiplied
      * @param int_b The second big_int to be multiplied
-     * @return A big_int that represents the result of the two big_ints multiplied
+     * @param subtract True if the product is subtracted instead of added
      */
-    friend big_int operator*(const big_int &int_a, const big_int &int_b);
+    friend constexpr void constant_addmul(big_int &result, const big_int &int_a, const big_int &int_b, const bool &subtract);
+
+    /**
+     * @brief A friend function that orders two big integers, the signs and the numbers of coefficients are compared
+     *        before any coefficient
+     */
+    friend constexpr strong_ordering operator<=>(const big_int &int_a, const big_int &int_b);
+
+    /**
+     * @brief A friend function that checks if two big integers are equal, the signs and the numbers of coefficients are
+     *        compared before any coefficient
+     */
+    friend constexpr bool operator==(const big_int &int_a, const big_int &int_b);
+
+    // Hashes the coefficients for unordered containers
+    friend struct std::hash<big_int>;
 
     /**
      * @brief A friend function that divides two big integers
@@ -67,18 +142,48 @@ class big_int
      */
     friend string print_base10(const big_int &integer);
 
+    // Builds its result directly from the coefficients it has summed
+    friend class big_int_accumulator;
+    friend class big_int_batch;
+
+    // Divide and conquer conversion to and from strings (see big_int.cpp)
+    friend class big_int_conversion;
+
+    /**
+     * @brief A friend function that writes a big integer in the binary format of big_int_binary.hpp
+     * @param out The stream to write to
+     * @param integer The big_int to write
+     */
+    friend void write_binary(ostream &out, const big_int &integer);
+
+    /**
+     * @brief A friend function that reads a big integer in the binary format of big_int_binary.hpp
+     * @param in The stream to read from
+     * @return The big_int read
+     */
+    friend big_int read_binary(istream &in);
+
+    // Copies the coefficients of a memory mapped file into a big_int
+    friend class big_int_view;
+
+    // Fills the coefficients of random big integers (see big_int_random.hpp)
+    friend class big_int_random;
+
+    // Operates on the coefficients with integers of the built in types (see big_int_native.hpp)
+    friend class big_int_native;
+
 public:
     /************************** Constructors ****************************/
     /**
      * @brief Initialize a big integer with value 0
      */
-    big_int();
+    constexpr big_int();
 
     /**
      * @brief Initialize a big integer from a 64 bit decimal integer (ie base 10)
      * @param integer a signed 64 bit decimal integer
      */
-    big_int(const int64_t &integer);
+    constexpr big_int(const int64_t &integer);
 
     /**
      * @brief Initialize a big integer from a string containing a base 10 integer
@@ -92,19 +197,33 @@ public:
      * @details These values would be 32 bit integers where the 1st integer represents the most significant integer of the big Integer
      * @param vec A vector of 32 bit integers
      */
-    big_int(const vector<uint32_t> &vec);
+    constexpr big_int(const vector<uint32_t> &vec);
 
     /**
      * @brief Copy Constructor -> Initialize a big integer (big_int) from another big integer
      * @param big_integer A big_int to copy
      */
-    big_int(const big_int &big_integer);
+    constexpr big_int(const big_int &big_integer);
+
+    /**
+     * @brief Move Constructor -> Initialize a big integer by taking over the coefficients of another big integer
+     * @details The moved from big_int is left with the value zero, its single coefficient is the only allocation
+     * @param big_integer A big_int to move from
+     */
+    constexpr big_int(big_int &&big_integer) noexcept;
+
+    /**
+     * @brief Initialize a big integer by evaluating a deferred expression of big integers (ie a + b * c)
+     * @param expression The expression to evaluate
+     */
+    template <class E>
+    constexpr big_int(const big_int_expr<E> &expression);
 
     /******************* Public Member Functions *******************/
     /**
      * @brief The negation operation of the current big integer
      */
-    void negate();
+    constexpr void negate();
 
     /**
      * @brief Checks if index is in range and gets coefficient at index
@@ -112,26 +231,95 @@ public:
      *          via vector vector::at()
      * @param index the index to find the coefficient at
      */
-    const uint32_t &at(const uint64_t &index) const;
+    constexpr const uint32_t &at(const uint64_t &index) const;
 
     /**
      * @brief Gets the number of coefficients in the big integer
      * @return an integer indicating the number of coefficients in the big integer
      */
-    uint64_t coefficient_size() const;
+    constexpr uint64_t coefficient_size() const;
+
+    /**
+     * @brief Converts the big integer to a string of digits in a radix, with a + or - sign in the beginning
+     * @details Digits above 9 are the lower case letters a-z. For a power of two radix (ie 2, 8, 16) each digit is a
+     *          group of bits of the coefficients, thus the conversion takes linear time; other radixes use the divide
+     *          and conquer method of print_base10. Throws the exception invalid_radix if the radix is not from 2 to 36.
+     * @param radix The radix of the digits, from 2 to 36
+     * @return A string containing the sign and digits of the big integer
+     */
+    string to_string(const uint32_t &radix = 10) const;
+
+    /**
+     * @brief Creates a big integer from a string of digits in a radix, with an optional + or - sign in the beginning
+     * @details Digits above 9 are the letters a-z or A-Z. A power of two radix takes linear time. Throws the exception
+     *          invalid_radix if the radix is not from 2 to 36 and invalid_string_integer if a character is not a digit
+     * @param integer The string of digits
+     * @param radix The radix of the digits, from 2 to 36
+     * @return The big_int the string represents
+     */
+    static big_int from_string(const string &integer, const uint32_t &radix = 10);
 
     /**
      * @brief Retrieves the sign of the integer, either positive or negative (zero will have a positive sign)
      * @return A sign object indicating the sign
      */
-    const sign &get_sign() const;
+    constexpr const sign &get_sign() const;
 
     /**
      * @brief Operator overload for the =
      * @param big_integer A big integer to be copied
      * @return A reference to a new big_int that is a copy of the argument
      */
-    big_int &operator=(const big_int &big_integer);
+    constexpr big_int &operator=(const big_int &big_integer);
+
+    /**
+     * @brief Operator overload for the = with a big_int that is no longer needed
+     * @details Nothing is allocated, the moved from big_int is left with the old value of this big_int
+     * @param big_integer A big integer to take the coefficients from
+     * @return A reference to this big_int
+     */
+    constexpr big_int &operator=(big_int &&big_integer) noexcept;
+
+    /**
+     * @brief Operator overload for the = with a deferred expression of big integers
+     * @details The expression is evaluated first, thus it may contain this big_int (ie x = x * y + z)
+     * @param expression The expression to evaluate
+     * @return A reference to this big_int
+     */
+    template <class E>
+    constexpr big_int &operator=(const big_int_expr<E> &expression);
+
+    /**
+     * @brief Operator overload for the +=
+     * @param big_integer A big integer to add to this big_int
+     * @return A reference to this big_int
+     */
+    constexpr big_int &operator+=(const big_int &big_integer);
+
+    /**
+     * @brief Operator overload for the += with a deferred expression
+     * @details A product (ie x += a * b) is accumulated directly into the coefficients of this big_int
+     * @param expression The expression to add to this big_int
+     * @return A reference to this big_int
+     */
+    template <class E>
+    constexpr big_int &operator+=(const big_int_expr<E> &expression);
+
+    /**
+     * @brief Operator overload for the -=
+     * @param big_integer A big integer to subtract from this big_int
+     * @return A reference to this big_int
+     */
+    constexpr big_int &operator-=(const big_int &big_integer);
+
+    /**
+     * @brief Operator overload for the -= with a deferred expression
+     * @details A product (ie x -= a * b) is subtracted directly from the coefficients of this big_int
+     * @param expression The expression to subtract from this big_int
+     * @return A reference to this big_int
+     */
+    template <class E>
+    constexpr big_int &operator-=(const big_int_expr<E> &expression);
 
 private:
     // List containing all coefficients for the big number starting with least significant at index 0
@@ -143,6 +331,13 @@ private:
     // Base value of the numbers stored in the vector, instead of base 10 it will be base 2^32
     uint64_t base = (uint64_t)UINT32_MAX + 1; //4294967296;
 
+    /**
+     * @brief Initialize a big integer with coefficients that are already in order, without copying them
+     * @param digits The coefficients starting with the least significant, they are moved
+     * @param digits_sign The sign of the integer
+     */
+    constexpr big_int(vector<uint32_t> &&digits, const sign &digits_sign);
+
     /**
      * @brief Increases the number of coefficients for the Big Integers by adding leading zeros
      * @param num_zeros The number of leading zer0 coefficients to add
@@ -152,7 +347,29 @@ private:
     /**
      * @brief Removes all leading 0 coefficients for the big number
      */
-    void shrink();
+    constexpr void shrink();
+
+    /**
+     * @brief Removes all leading 0 coefficients and gives the value zero a positive sign
+     */
+    constexpr void normalize();
+
+    /**
+     * @brief Checks if the big integer has the value zero
+     * @return true if the only coefficient is 0
+     */
+    constexpr bool is_zero() const;
+
+    /**
+     * @brief Adds the product of two vectors of coefficients directly into the current big number
+     * @details Helper function for addmul, submul, addmul_1 and submul_1. The coefficients must not belong to the current big number
+     * @param short_digits The coefficients of the integer with fewer digits
+     * @param short_size The number of coefficients in short_digits
+     * @param long_digits The coefficients of the other integer
+     * @param long_size The number of coefficients in long_digits
+     * @param product_negative True if the product is negative
+     */
+    void add_product(const uint32_t *short_digits, const uint64_t &short_size, const uint32_t *long_digits, const uint64_t &long_size, const bool &product_negative);
 
     /**
      * @brief Multiplies an unsigned 32 bit integer to the current big number
@@ -182,13 +399,6 @@ private:
      * @return integer indicating the remainder
      */
     uint32_t remainder_32(const uint32_t &integer) const;
-
-    /**
-     * @brief Finds the radix complement of the big integer where the radix is 2^32
-     * @details This will be used for addition
-     * @return a vector of unsigned 32 bit integers representing the radix complement of the big int
-     */
-    vector<uint32_t> radix_complement() const;
 };
 
 /***************************** Exceptions ***************************/
@@ -201,6 +411,15 @@ public:
     invalid_string_integer() : invalid_argument("Invalid character found. The integer string inputted for the big_int can not have any other characters but numbers and a + or - sign in the beginning"){};
 };
 
+/**
+ * @brief Exception to be thrown if the radix of a string of digits is not supported
+ */
+class invalid_radix : public invalid_argument
+{
+public:
+    invalid_radix() : invalid_argument("The radix of the digits of a big integer must be from 2 to 36"){};
+};
+
 /**
  * @brief Exception to be thrown if dividing by zero
  */
@@ -211,13 +430,20 @@ public:
 };
 
 /************************** Helper Functions and Other Operator Overloads *************************/
+/*
+ * The comparisons expect normalized integers (no leading zero coefficients and a positive zero), which every operation
+ * gives. They compare the signs and then the numbers of coefficients before the coefficients themselves, thus integers
+ * of different signs or sizes are ordered without reading their coefficients; the coefficients of equal integers are
+ * compared as a block of memory.
+ */
+
 /**
- * @brief Negation operator overload 
- * @details Finds the negation of the argument big int and returns a new big int with the negation value
- * @param int_a The big_int to be negated
- * @return A big_int that represents the result 
+ * @brief Operator overload for <=>, also gives the operators <= and >=
+ * @param int_a the first big_int to compare
+ * @param int_b the second big_int to compare
+ * @return strong_ordering::less, equal or greater as int_a is less than, equal to or greater than int_b
  */
-big_int operator-(const big_int &int_a);
+constexpr strong_ordering operator<=>(const big_int &int_a, const big_int &int_b);
 
 /**
  * @brief Operator overload for <
@@ -225,7 +451,7 @@ big_int operator-(const big_int &int_a);
  * @param int_b the second big_int to compare
  * @return A boolean value stating if int_a < int_b
  */
-bool operator<(const big_int &int_a, const big_int &int_b);
+constexpr bool operator<(const big_int &int_a, const big_int &int_b);
 
 /**
  * @brief Operator overload for >
@@ -233,7 +459,7 @@ bool operator<(const big_int &int_a, const big_int &int_b);
  * @param int_b the second big_int to compare
  * @return A boolean value stating if int_a > int_b
  */
-bool operator>(const big_int &int_a, const big_int &int_b);
+constexpr bool operator>(const big_int &int_a, const big_int &int_b);
 
 /**
  * @brief Operator overload for !=
@@ -241,7 +467,7 @@ bool operator>(const big_int &int_a, const big_int &int_b);
  * @param int_b the second big_int to compare
  * @return A boolean value stating if int_a != int_b
  */
-bool operator!=(const big_int &int_a, const big_int &int_b);
+constexpr bool operator!=(const big_int &int_a, const big_int &int_b);
 
 /**
  * @brief Operator overload for ==
@@ -249,7 +475,22 @@ bool operator!=(const big_int &int_a, const big_int &int_b);
  * @param int_b the second big_int to compare
  * @return A boolean value stating if int_a == int_b
  */
-bool operator==(const big_int &int_a, const big_int &int_b);
+constexpr bool operator==(const big_int &int_a, const big_int &int_b);
+
+/**
+ * @brief Hash of a big integer, so big integers can be the keys of unordered_map and unordered_set
+ * @details The coefficients are mixed two at a time as 64 bit words, equal big integers have equal hashes
+ */
+template <>
+struct std::hash<big_int>
+{
+    /**
+     * @brief Hashes a big integer
+     * @param integer The big_int to hash
+     * @return The hash of the sign and the coefficients
+     */
+    constexpr size_t operator()(const big_int &integer) const noexcept;
+};
 
 /**
  * @brief Adds two vectors element by element and incorporates the carry as if adding two big integers
@@ -259,3 +500,469 @@ bool operator==(const big_int &int_a, const big_int &int_b);
  * @return a vector of 64 bit integers representing the sum of the two vectors
  */
 vector<uint32_t> add_coefficients(const vector<uint32_t> &vec1, const vector<uint32_t> &vec2);
+
+/************************** Conversion to and from Buffers *************************/
+/*
+ * These functions work like std::to_chars and std::from_chars: they only use the buffer of the caller and report
+ * errors with an error code instead of an exception. The sign is only written for a negative integer. Integers of
+ * less than conversion_threshold() coefficients (and any integer in a power of two radix) are converted without
+ * allocating memory, larger ones only allocate the big integers of the divide and conquer method.
+ */
+
+/**
+ * @brief Writes the digits of a big integer to a buffer, with a - sign if it is negative
+ * @param first The first character of the buffer
+ * @param last The character after the buffer
+ * @param integer The big_int to write
+ * @param radix The radix of the digits, from 2 to 36
+ * @return ptr is the character after the last digit written; ec is errc::value_too_large (and ptr is last) if the
+ *         digits do not fit, errc::invalid_argument if the radix is not from 2 to 36, otherwise errc()
+ */
+to_chars_result to_chars(char *first, char *last, const big_int &integer, const uint32_t &radix = 10);
+
+/**
+ * @brief Reads a big integer from the digits at the start of a buffer, with an optional + or - sign
+ * @details The digits are read until the first character that is not a digit of the radix
+ * @param first The first character of the buffer
+ * @param last The character after the buffer
+ * @param integer Set to the big_int read, unchanged if there is an error
+ * @param radix The radix of the digits, from 2 to 36
+ * @return ptr is the first character that was not read; ec is errc::invalid_argument (and ptr is first) if there are
+ *         no digits or the radix is not from 2 to 36, otherwise errc()
+ */
+from_chars_result from_chars(const char *first, const char *last, big_int &integer, const uint32_t &radix = 10);
+
+/**
+ * @brief Finds the size of a buffer that to_chars always fits in, to size a buffer before writing
+ * @param integer The big_int to write
+ * @param radix The radix of the digits, from 2 to 36
+ * @return The number of characters including the sign, exact for a power of two radix and at most two more than
+ *         needed otherwise
+ */
+uint64_t to_chars_size(const big_int &integer, const uint32_t &radix = 10);
+
+/************************** Streaming Output *************************/
+/**
+ * @brief Gives the base 10 digits of a big integer, with a + or - sign in the beginning, to a function in chunks of
+ *        at most 65536 characters, the most significant digits first
+ * @details The integer is split by powers of 10 like print_base10, but only the high half of each split is split
+ *          again before its digits are given to the function, thus the first chunk is ready after about two
+ *          multiplications of the size of the integer and no string of all the digits is built. The extra memory is
+ *          about the size of the powers of 10 and the low halves waiting to be written, a few times the size of the
+ *          integer in base 2^32 (less than half the size of its digits).
+ * @param integer The big_int to write
+ * @param sink The function called with each chunk of digits and its number of characters
+ */
+void stream_base10(const big_int &integer, const function<void(const char *, const uint64_t &)> &sink);
+
+/**
+ * @brief Writes the base 10 digits of a big integer, with a + or - sign in the beginning, to a stream in chunks
+ * @details Writes the same characters as print_base10 without building the string, see stream_base10
+ * @param out The stream to write to
+ * @param integer The big_int to write
+ */
+void write_base10(ostream &out, const big_int &integer);
+
+/************************** Algorithm Settings *************************/
+/**
+ * @brief Sets the number of coefficients from which multiplication uses the Karatsuba method instead of the basic method
+ * @param coefficients The number of coefficients of the smaller integer, at least 4
+ */
+void set_karatsuba_threshold(const uint64_t &coefficients);
+
+/**
+ * @brief Gets the number of coefficients from which multiplication uses the Karatsuba method
+ * @return The number of coefficients of the smaller integer
+ */
+uint64_t karatsuba_threshold();
+
+/**
+ * @brief Sets the number of coefficients from which the parts of a multiplication are run in parallel on the threads
+ *        set with set_big_int_threads() (see thread_pool.hpp)
+ * @param coefficients The number of coefficients of the smaller integer
+ */
+void set_parallel_multiply_threshold(const uint64_t &coefficients);
+
+/**
+ * @brief Gets the number of coefficients from which the parts of a multiplication are run in parallel
+ * @return The number of coefficients of the smaller integer
+ */
+uint64_t parallel_multiply_threshold();
+
+/**
+ * @brief Sets the number of coefficients of the divisor and of the quotient from which division uses Barrett reduction
+ *        (two multiplications by the reciprocal of the divisor per step) instead of long division
+ * @param coefficients The number of coefficients of the divisor and of the quotient
+ */
+void set_division_threshold(const uint64_t &coefficients);
+
+/**
+ * @brief Gets the number of coefficients of the divisor and of the quotient from which division uses Barrett reduction
+ * @return The number of coefficients of the divisor and of the quotient
+ */
+uint64_t division_threshold();
+
+/**
+ * @brief Sets the number of coefficients from which print_base10 uses the divide and conquer method instead of repeated division by 10^9
+ * @details The string constructor uses the divide and conquer method for strings of more than 9 digits per coefficient
+ * @param coefficients The number of coefficients of the integer, at least 2
+ */
+void set_conversion_threshold(const uint64_t &coefficients);
+
+/**
+ * @brief Gets the number of coefficients from which print_base10 uses the divide and conquer method
+ * @return The number of coefficients of the integer
+ */
+uint64_t conversion_threshold();
+
+/**
+ * @brief Sets the number of coefficients from which the halves of an integer are converted to or from a string in parallel
+ *        on the threads set with set_big_int_threads() (see thread_pool.hpp)
+ * @param coefficients The number of coefficients of the integer being split
+ */
+void set_parallel_conversion_threshold(const uint64_t &coefficients);
+
+/**
+ * @brief Gets the number of coefficients from which the halves of an integer are converted to a string in parallel
+ * @return The number of coefficients of the integer being split
+ */
+uint64_t parallel_conversion_threshold();
+
+/************************** Constant Expression Definitions *************************/
+/*
+ * The functions below are defined in the header so that big integers can be created, compared, added, subtracted and
+ * multiplied in constant expressions (ie static_assert(2_bi * 3_bi == 6_bi), see big_int_literal.hpp for the _bi
+ * literal). Everything else is defined in big_int.cpp.
+ */
+constexpr big_int::big_int() : coefficient({0}){};
+
+constexpr big_int::big_int(const int64_t &integer)
+{
+    // Add the coefficients/digits for the integer in base 2^32
+    uint64_t value = integer;
+    // If value is negative save as a positive and update sign
+    if (integer < 0)
+    {
+        integer_sign = sign::NEGATIVE;
+        value = 0 - value;
+    }
+
+    // Divide by base of 2^32 and add remainder to the coefficient vector of digits
+    uint32_t remainder = (uint32_t)(value % base);
+    coefficient.push_back(remainder);
+    while (value >= base)
+    {
+        value = value / base;
+        remainder = (uint32_t)(value % base); // remainder always < base
+        coefficient.push_back(remainder);
+    }
+}
+
+constexpr big_int::big_int(const vector<uint32_t> &vec)
+{
+    // Reverse the vector such that the most significant digit is at the last index
+    coefficient.reserve(vec.size());
+    for (uint64_t i = vec.size(); i > 0; i--)
+    {
+        coefficient.push_back(vec[i - 1]);
+    }
+}
+
+constexpr big_int::big_int(const big_int &big_integer) : coefficient(big_integer.coefficient), integer_sign(big_integer.integer_sign)
+{
+    // The digits are copied with a single allocation, see shared_big_int.hpp for copies that share them instead
+}
+
+constexpr big_int::big_int(big_int &&big_integer) noexcept : coefficient(std::move(big_integer.coefficient)), integer_sign(big_integer.integer_sign)
+{
+    // Leave the moved from big integer with the value zero. If even a single coefficient can not be allocated the
+    // exception must not leave this noexcept constructor, then the moved from big integer has no coefficients and may
+    // only be assigned or destroyed
+    big_integer.integer_sign = sign::POSITIVE;
+    try
+    {
+        big_integer.coefficient.assign(1, 0);
+    }
+    catch (const bad_alloc &e)
+    {
+    }
+}
+
+constexpr big_int::big_int(vector<uint32_t> &&digits, const sign &digits_sign) : coefficient(std::move(digits)), integer_sign(digits_sign)
+{
+}
+
+constexpr void big_int::negate()
+{
+    // Change sign flag
+    if (integer_sign == sign::POSITIVE)
+    {
+        integer_sign = sign::NEGATIVE;
+    }
+    else
+    {
+        integer_sign = sign::POSITIVE;
+    }
+}
+
+constexpr const uint32_t &big_int::at(const uint64_t &index) const
+{
+    return coefficient.at(index);
+}
+
+constexpr uint64_t big_int::coefficient_size() const
+{
+    return coefficient.size();
+}
+
+constexpr const sign &big_int::get_sign() const
+{
+    return integer_sign;
+}
+
+// Referenced: https://en.cppreference.com/w/cpp/language/operators
+constexpr big_int &big_int::operator=(const big_int &big_integer)
+{
+
+    // Self assignment
+    if (this == &big_integer)
+    {
+        return *this;
+    }
+
+    // Set the coefficient and integer_sign of this object to that of argument
+    coefficient = big_integer.coefficient;
+    integer_sign = big_integer.get_sign();
+
+    // return object
+    return *this;
+}
+
+constexpr big_int &big_int::operator=(big_int &&big_integer) noexcept
+{
+    // Swap so the old coefficients are freed along with the argument
+    coefficient.swap(big_integer.coefficient);
+    integer_sign = big_integer.integer_sign;
+    return *this;
+}
+
+constexpr void big_int::shrink()
+{
+    // Do not shrink if value is 0 with only one digit
+    if (coefficient.size() > 1)
+    {
+        // Remove all leading zeros until reach a digit that is not zero
+        bool number_reached = false;
+        for (uint64_t i = coefficient.size() - 1; i > 0 && !number_reached; i--)
+        {
+            if (coefficient[i] == 0)
+            {
+                coefficient.erase(coefficient.begin() + i);
+            }
+            else
+            {
+                number_reached = true;
+            }
+        }
+    }
+}
+
+constexpr void big_int::normalize()
+{
+    shrink();
+
+    // Zero is always positive
+    if (is_zero())
+    {
+        integer_sign = sign::POSITIVE;
+    }
+}
+
+constexpr bool big_int::is_zero() const
+{
+    return coefficient.size() == 1 && coefficient[0] == 0;
+}
+
+constexpr strong_ordering operator<=>(const big_int &int_a, const big_int &int_b)
+{
+    // Integers of different signs are ordered by their signs
+    bool a_negative = int_a.integer_sign == sign::NEGATIVE;
+    if (a_negative != (int_b.integer_sign == sign::NEGATIVE))
+    {
+        return a_negative ? strong_ordering::less : strong_ordering::greater;
+    }
+
+    // Otherwise by their magnitudes, the one with more digits is larger, then the first digit that differs starting
+    // with the most significant, the order is reversed if both are negative
+    uint64_t size = int_a.coefficient.size();
+    strong_ordering order = size <=> int_b.coefficient.size();
+    if (order == 0)
+    {
+        const uint32_t *a_digits = int_a.coefficient.data();
+        const uint32_t *b_digits = int_b.coefficient.data();
+        uint64_t i = size;
+        while (i > 0 && a_digits[i - 1] == b_digits[i - 1])
+        {
+            i--;
+        }
+        order = i > 0 ? a_digits[i - 1] <=> b_digits[i - 1] : strong_ordering::equal;
+    }
+    return a_negative ? 0 <=> order : order;
+}
+
+constexpr bool operator<(const big_int &int_a, const big_int &int_b)
+{
+    return (int_a <=> int_b) < 0;
+}
+
+constexpr bool operator>(const big_int &int_a, const big_int &int_b)
+{
+    return (int_a <=> int_b) > 0;
+}
+
+constexpr bool operator!=(const big_int &int_a, const big_int &int_b)
+{
+    return !(int_a == int_b);
+}
+
+constexpr bool operator==(const big_int &int_a, const big_int &int_b)
+{
+    // Normalized integers with a different sign or number of digits are different, otherwise every digit is compared
+    if (int_a.integer_sign != int_b.integer_sign || int_a.coefficient.size() != int_b.coefficient.size())
+    {
+        return false;
+    }
+    return equal(int_a.coefficient.begin(), int_a.coefficient.end(), int_b.coefficient.begin());
+}
+
+constexpr size_t std::hash<big_int>::operator()(const big_int &integer) const noexcept
+{
+    // Each 64 bit word of two coefficients is mixed into the hash with a multiplication, then the bits of the hash are
+    // mixed again as the finalizer of splitmix64 so every bit of the coefficients changes every bit of the hash
+    const vector<uint32_t> &digits = integer.coefficient;
+    uint64_t size = digits.size();
+
+    // The sign and the number of coefficients start the hash in its high bits, so they are not cancelled by the digits
+    uint64_t hash = (size << 1 | (integer.integer_sign == sign::NEGATIVE ? 1 : 0)) * 0x9e3779b97f4a7c15;
+    hash ^= hash >> 32;
+
+    // Long integers are hashed in two independent lanes of alternating words, so the multiplications overlap
+    uint64_t i = 0;
+    if (size >= 8)
+    {
+        uint64_t lane = hash ^ 0x2545f4914f6cdd1d;
+        for (; i + 3 < size; i += 4)
+        {
+            uint64_t word = digits[i] | (uint64_t)digits[i + 1] << 32;
+            uint64_t lane_word = digits[i + 2] | (uint64_t)digits[i + 3] << 32;
+            hash = (hash ^ word) * 0x9fb21c651e98df25;
+            lane = (lane ^ lane_word) * 0x9fb21c651e98df25;
+            hash ^= hash >> 29;
+            lane ^= lane >> 29;
+        }
+        hash = (hash ^ (lane >> 32 | lane << 32)) * 0x9fb21c651e98df25;
+    }
+    for (; i + 1 < size; i += 2)
+    {
+        uint64_t word = digits[i] | (uint64_t)digits[i + 1] << 32;
+        hash = (hash ^ word) * 0x9fb21c651e98df25;
+        hash ^= hash >> 29;
+    }
+    if (i < size)
+    {
+        hash = (hash ^ digits[i]) * 0x9fb21c651e98df25;
+        hash ^= hash >> 29;
+    }
+    hash = (hash ^ (hash >> 30)) * 0xbf58476d1ce4e5b9;
+    hash = (hash ^ (hash >> 27)) * 0x94d049bb133111eb;
+    return (size_t)(hash ^ (hash >> 31));
+}
+
+constexpr void constant_add(big_int &result, const big_int &term, const bool &subtract)
+{
+    if (term.is_zero())
+    {
+        return;
+    }
+
+    bool term_negative = (term.integer_sign == sign::NEGATIVE) != subtract;
+    bool result_negative = result.integer_sign == sign::NEGATIVE && !result.is_zero();
+    vector<uint32_t> &digits = result.coefficient;
+    const vector<uint32_t> &other = term.coefficient;
+
+    // Add the magnitudes when both have the same sign
+    if (result_negative == term_negative || result.is_zero())
+    {
+        if (digits.size() < other.size())
+        {
+            digits.resize(other.size(), 0);
+        }
+        uint64_t carry = 0;
+        for (uint64_t i = 0; i < digits.size(); i++)
+        {
+            uint64_t temp = (uint64_t)digits[i] + (i < other.size() ? other[i] : 0) + carry;
+            digits[i] = (uint32_t)(temp & (uint64_t)UINT32_MAX);
+            carry = temp >> 32;
+        }
+        if (carry != 0)
+        {
+            digits.push_back((uint32_t)carry);
+        }
+        result.integer_sign = term_negative ? sign::NEGATIVE : sign::POSITIVE;
+        result.normalize();
+        return;
+    }
+
+    // Otherwise subtract the smaller magnitude from the larger one, which gives the sign
+    bool term_larger = digits.size() < other.size();
+    if (digits.size() == other.size())
+    {
+        for (uint64_t i = digits.size(); i > 0; i--)
+        {
+            if (digits[i - 1] != other[i - 1])
+            {
+                term_larger = digits[i - 1] < other[i - 1];
+                break;
+            }
+        }
+    }
+    vector<uint32_t> larger = term_larger ? other : digits;
+    vector<uint32_t> smaller = term_larger ? digits : other;
+    uint64_t borrow = 0;
+    for (uint64_t i = 0; i < larger.size(); i++)
+    {
+        uint64_t subtrahend = (i < smaller.size() ? smaller[i] : 0) + borrow;
+        borrow = larger[i] < subtrahend ? 1 : 0;
+        larger[i] = (uint32_t)((larger[i] + (borrow << 32) - subtrahend) & (uint64_t)UINT32_MAX);
+    }
+    digits = larger;
+    result.integer_sign = term_larger == term_negative ? sign::NEGATIVE : sign::POSITIVE;
+    result.normalize();
+}
+
+constexpr void constant_addmul(big_int &result, const big_int &int_a, const big_int &int_b, const bool &subtract)
+{
+    // Schoolbook multiplication, the compiler only evaluates small products
+    big_int product;
+    product.coefficient.assign(int_a.coefficient.size() + int_b.coefficient.size(), 0);
+    for (uint64_t i = 0; i < int_a.coefficient.size(); i++)
+    {
+        uint64_t carry = 0;
+        for (uint64_t j = 0; j < int_b.coefficient.size(); j++)
+        {
+            uint64_t temp = (uint64_t)int_a.coefficient[i] * int_b.coefficient[j] + product.coefficient[i + j] + carry;
+            product.coefficient[i + j] = (uint32_t)(temp & (uint64_t)UINT32_MAX);
+            carry = temp >> 32;
+        }
+        product.coefficient[i + int_b.coefficient.size()] = (uint32_t)carry;
+    }
+    product.integer_sign = int_a.integer_sign != int_b.integer_sign ? sign::NEGATIVE : sign::POSITIVE;
+    product.normalize();
+    constant_add(result, product, subtract);
+}
+
+#include "big_int_expr.hpp"
+
+#include "big_int_literal.hpp"
+
+#include "big_int_native.hpp"
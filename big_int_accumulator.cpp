@@ -0,0 +1,130 @@
+/**
+ * @file big_int_accumulator.cpp
+ * @author Gabrielle Ching-Johnson
+ * @brief C++ code file for the carry-save big integer accumulator
+ * @version 0.3
+ * @date Oct 18, 2026
+ */
+
+#include <vector>
+#include <cstdint>
+#include "big_int_accumulator.hpp"
+using namespace std;
+
+/**
+ * @brief Propagates the carries of partial sums and writes the 32 bit coefficients of their total
+ * @param sums The partial sums, least significant at index 0
+ * @return A vector of 32 bit coefficients with the value of the sums
+ */
+static vector<uint32_t> sums_to_coefficients(const vector<uint64_t> &sums)
+{
+    vector<uint32_t> digits;
+    digits.reserve(sums.size() + 2);
+
+    // The carry can be up to 2^32 times the base thus it can take two more coefficients
+    uint64_t carry = 0;
+    for (const uint64_t &sum : sums)
+    {
+        uint64_t low = (sum & (uint64_t)UINT32_MAX) + (carry & (uint64_t)UINT32_MAX);
+        digits.push_back((uint32_t)(low & (uint64_t)UINT32_MAX));
+        carry = (sum >> 32) + (carry >> 32) + (low >> 32);
+    }
+    while (carry != 0)
+    {
+        digits.push_back((uint32_t)(carry & (uint64_t)UINT32_MAX));
+        carry = carry >> 32;
+    }
+
+    if (digits.empty())
+    {
+        digits.push_back(0);
+    }
+    return digits;
+}
+
+/******************************* Constructors ******************************/
+big_int_accumulator::big_int_accumulator(){};
+
+/******************************** Public Functions ******************************/
+void big_int_accumulator::add(const big_int &integer)
+{
+    if (integer.get_sign() == sign::NEGATIVE)
+        add_coefficients_to(negative_sums, integer);
+    else
+        add_coefficients_to(positive_sums, integer);
+}
+
+void big_int_accumulator::subtract(const big_int &integer)
+{
+    if (integer.get_sign() == sign::NEGATIVE)
+        add_coefficients_to(positive_sums, integer);
+    else
+        add_coefficients_to(negative_sums, integer);
+}
+
+big_int_accumulator &big_int_accumulator::operator+=(const big_int &integer)
+{
+    add(integer);
+    return *this;
+}
+
+big_int_accumulator &big_int_accumulator::operator-=(const big_int &integer)
+{
+    subtract(integer);
+    return *this;
+}
+
+big_int big_int_accumulator::value() const
+{
+    big_int positive;
+    big_int negative;
+    positive.coefficient = sums_to_coefficients(positive_sums);
+    negative.coefficient = sums_to_coefficients(negative_sums);
+
+    // Subtract the total of the negative big integers from the total of the positive ones in a single pass
+    big_int total;
+    big_int_term terms[2] = {{&positive, false}, {&negative, true}};
+    linear_combination(total, terms, 2);
+    return total;
+}
+
+void big_int_accumulator::clear()
+{
+    positive_sums.clear();
+    negative_sums.clear();
+    pending = 0;
+}
+
+/******************************* Private Functions ******************************/
+void big_int_accumulator::add_coefficients_to(vector<uint64_t> &sums, const big_int &integer)
+{
+    // Each partial sum is less than 2^32 after propagating, thus 2^32 - 1 more coefficients can be added without overflow
+    if (pending == UINT32_MAX)
+    {
+        propagate_carries();
+    }
+    pending++;
+
+    uint64_t size = integer.coefficient_size();
+    if (sums.size() < size)
+    {
+        sums.resize(size, 0);
+    }
+
+    // Add coefficient by coefficient, no carry is propagated
+    const uint32_t *digits = integer.coefficient.data();
+    for (uint64_t i = 0; i < size; i++)
+    {
+        sums[i] += digits[i];
+    }
+}
+
+void big_int_accumulator::propagate_carries()
+{
+    for (vector<uint64_t> *sums : {&positive_sums, &negative_sums})
+    {
+        vector<uint32_t> digits = sums_to_coefficients(*sums);
+        sums->assign(digits.begin(), digits.end());
+    }
+    pending = 0;
+}
@@ -0,0 +1,87 @@
+#pragma once
+/**
+ * @file big_int_accumulator.hpp
+ * @author Gabrielle Ching-Johnson
+ * @brief Header file for an accumulator that sums many big integers without propagating carries on every addition
+ * @version 0.3
+ * @date Oct 18, 2026
+ */
+
+#include <vector>
+#include <cstdint>
+#include "big_int.hpp"
+using namespace std;
+
+/**
+ * @brief This class sums many big integers, keeping a 64 bit partial sum for each coefficient (carry-save form)
+ * @details Adding a big_int only adds each of its coefficients to the partial sum at the same index, thus no carry is
+ *          propagated and the sums are only reallocated when a bigger big_int is added. The carries are propagated when
+ *          the value is read, or after 2^32 - 1 additions, before a partial sum could overflow.
+ */
+class big_int_accumulator
+{
+public:
+    /**
+     * @brief Initialize an accumulator with value 0
+     */
+    big_int_accumulator();
+
+    /**
+     * @brief Adds a big integer to the accumulator
+     * @param integer The big_int to add
+     */
+    void add(const big_int &integer);
+
+    /**
+     * @brief Subtracts a big integer from the accumulator
+     * @param integer The big_int to subtract
+     */
+    void subtract(const big_int &integer);
+
+    /**
+     * @brief Operator overload for the +=, same as add()
+     * @param integer The big_int to add
+     * @return A reference to this accumulator
+     */
+    big_int_accumulator &operator+=(const big_int &integer);
+
+    /**
+     * @brief Operator overload for the -=, same as subtract()
+     * @param integer The big_int to subtract
+     * @return A reference to this accumulator
+     */
+    big_int_accumulator &operator-=(const big_int &integer);
+
+    /**
+     * @brief Propagates the carries of the partial sums and returns the total
+     * @return A big_int with the value of the sum of all big integers added and subtracted
+     */
+    big_int value() const;
+
+    /**
+     * @brief Resets the accumulator to the value 0
+     */
+    void clear();
+
+private:
+    // Partial sums of the coefficients of the positive big integers added, least significant at index 0
+    vector<uint64_t> positive_sums;
+
+    // Partial sums of the coefficients of the negative big integers added (and positive ones subtracted)
+    vector<uint64_t> negative_sums;
+
+    // Number of big integers added since the carries were last propagated
+    uint64_t pending = 0;
+
+    /**
+     * @brief Adds the coefficients of a big integer to one of the partial sums
+     * @param sums The partial sums to add to
+     * @param integer The big_int whose coefficients are added
+     */
+    void add_coefficients_to(vector<uint64_t> &sums, const big_int &integer);
+
+    /**
+     * @brief Propagates the carries of both partial sums so every partial sum is less than 2^32 again
+     */
+    void propagate_carries();
+};
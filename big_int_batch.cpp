@@ -0,0 +1,327 @@
+/**
+ * @file big_int_batch.cpp
+ * @author Gabrielle Ching-Johnson
+ * @brief C++ code file for the structure of arrays batch of big integers
+ * @version 0.3
+ * @date Oct 18, 2026
+ */
+
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+#include <bit>
+#include <functional>
+#include "big_int_batch.hpp"
+#include "thread_pool.hpp"
+using namespace std;
+
+// Number of lanes processed together, small enough that the carries of a block stay in the cache
+static const uint64_t lane_block = 256;
+
+/**
+ * @brief Runs body(first, last) for blocks of lanes, in parallel when the batch has several blocks
+ * @param count The number of lanes
+ * @param body The function to run for the lanes [first, last)
+ */
+static void for_each_block(const uint64_t &count, const function<void(uint64_t, uint64_t)> &body)
+{
+    uint64_t blocks = (count + lane_block - 1) / lane_block;
+    parallel_for(big_int_thread_pool(), blocks, [&](uint64_t block)
+                 { body(block * lane_block, min(count, (block + 1) * lane_block)); });
+}
+
+/******************************* Constructors ******************************/
+big_int_batch::big_int_batch(const uint64_t &count, const uint64_t &width) : count(count), coefficients(width == 0 ? 1 : width), limbs(count * coefficients, 0){};
+
+big_int_batch::big_int_batch(const vector<big_int> &integers, const uint64_t &width) : count(integers.size()), coefficients(width)
+{
+    // The smallest width has room for the bits of the largest magnitude and a sign bit
+    if (coefficients == 0)
+    {
+        coefficients = 1;
+        for (const big_int &integer : integers)
+        {
+            uint64_t size = integer.coefficient.size();
+            while (size > 1 && integer.coefficient[size - 1] == 0)
+            {
+                size--;
+            }
+            uint64_t bits = (size - 1) * 32 + (uint64_t)bit_width(integer.coefficient[size - 1]);
+            coefficients = max(coefficients, bits / 32 + 1);
+        }
+    }
+
+    limbs.assign(count * coefficients, 0);
+    for (uint64_t i = 0; i < count; i++)
+    {
+        set(i, integers[i]);
+    }
+}
+
+/******************************* Member Functions ******************************/
+uint64_t big_int_batch::size() const
+{
+    return count;
+}
+
+uint64_t big_int_batch::width() const
+{
+    return coefficients;
+}
+
+void big_int_batch::set(const uint64_t &index, const big_int &integer)
+{
+    for (uint64_t j = coefficients; j < integer.coefficient.size(); j++)
+    {
+        if (integer.coefficient[j] != 0)
+        {
+            throw batch_width_overflow();
+        }
+    }
+
+    // Store the two's complement of negative integers (invert and add one)
+    bool negative = integer.integer_sign == sign::NEGATIVE && any_of(integer.coefficient.begin(), integer.coefficient.end(), [](const uint32_t &digit)
+                                                                     { return digit != 0; });
+    uint32_t invert = negative ? UINT32_MAX : 0;
+    uint64_t carry = negative ? 1 : 0;
+    for (uint64_t j = 0; j < coefficients; j++)
+    {
+        uint32_t digit = j < integer.coefficient.size() ? integer.coefficient[j] : 0;
+        uint64_t temp = (uint64_t)(digit ^ invert) + carry;
+        limbs[j * count + index] = (uint32_t)(temp & (uint64_t)UINT32_MAX);
+        carry = temp >> 32;
+    }
+
+    // The sign bit must match the sign, else the magnitude needs the sign bit
+    bool sign_bit = (limbs[(coefficients - 1) * count + index] >> 31) != 0;
+    if (sign_bit != negative)
+    {
+        throw batch_width_overflow();
+    }
+}
+
+big_int big_int_batch::get(const uint64_t &index) const
+{
+    big_int integer;
+    integer.coefficient.resize(coefficients);
+
+    // Negate negative integers back to their magnitude
+    bool negative = (limbs[(coefficients - 1) * count + index] >> 31) != 0;
+    uint32_t invert = negative ? UINT32_MAX : 0;
+    uint64_t carry = negative ? 1 : 0;
+    for (uint64_t j = 0; j < coefficients; j++)
+    {
+        uint64_t temp = (uint64_t)(limbs[j * count + index] ^ invert) + carry;
+        integer.coefficient[j] = (uint32_t)(temp & (uint64_t)UINT32_MAX);
+        carry = temp >> 32;
+    }
+    integer.integer_sign = negative ? sign::NEGATIVE : sign::POSITIVE;
+    integer.normalize();
+    return integer;
+}
+
+vector<big_int> big_int_batch::to_big_ints() const
+{
+    vector<big_int> integers(count);
+    for (uint64_t i = 0; i < count; i++)
+    {
+        integers[i] = get(i);
+    }
+    return integers;
+}
+
+/******************************* Private Functions ******************************/
+const uint32_t *big_int_batch::row(const uint64_t &position, const vector<uint32_t> &extension) const
+{
+    return position < coefficients ? limbs.data() + position * count : extension.data();
+}
+
+vector<uint32_t> big_int_batch::sign_extension() const
+{
+    vector<uint32_t> extension(count);
+    const uint32_t *top = limbs.data() + (coefficients - 1) * count;
+    for (uint64_t i = 0; i < count; i++)
+    {
+        extension[i] = 0 - (top[i] >> 31);
+    }
+    return extension;
+}
+
+big_int_batch big_int_batch::add_or_subtract(const big_int_batch &batch_a, const big_int_batch &batch_b, const bool &subtract)
+{
+    if (batch_a.count != batch_b.count)
+    {
+        throw batch_size_mismatch();
+    }
+
+    uint64_t count = batch_a.count;
+    big_int_batch result(count, max(batch_a.coefficients, batch_b.coefficients) + 1);
+    vector<uint32_t> extension_a = batch_a.sign_extension();
+    vector<uint32_t> extension_b = batch_b.sign_extension();
+
+    // a - b = a + ~b + 1 in two's complement
+    uint32_t invert = subtract ? UINT32_MAX : 0;
+    for_each_block(count, [&](uint64_t first, uint64_t last)
+                   {
+                       uint64_t lanes = last - first;
+                       vector<uint32_t> carry(lanes, subtract ? 1 : 0);
+                       for (uint64_t j = 0; j < result.coefficients; j++)
+                       {
+                           const uint32_t *row_a = batch_a.row(j, extension_a) + first;
+                           const uint32_t *row_b = batch_b.row(j, extension_b) + first;
+                           uint32_t *out = result.limbs.data() + j * count + first;
+
+                           // The same carry step for every lane, which the compiler vectorizes
+                           for (uint64_t i = 0; i < lanes; i++)
+                           {
+                               uint64_t temp = (uint64_t)row_a[i] + (row_b[i] ^ invert) + carry[i];
+                               out[i] = (uint32_t)temp;
+                               carry[i] = (uint32_t)(temp >> 32);
+                           }
+                       } });
+    return result;
+}
+
+/******************************* Friend Functions ******************************/
+big_int_batch operator+(const big_int_batch &batch_a, const big_int_batch &batch_b)
+{
+    return big_int_batch::add_or_subtract(batch_a, batch_b, false);
+}
+
+big_int_batch operator-(const big_int_batch &batch_a, const big_int_batch &batch_b)
+{
+    return big_int_batch::add_or_subtract(batch_a, batch_b, true);
+}
+
+big_int_batch operator*(const big_int_batch &batch_a, const big_int_batch &batch_b)
+{
+    if (batch_a.count != batch_b.count)
+    {
+        throw batch_size_mismatch();
+    }
+
+    uint64_t count = batch_a.count;
+    uint64_t width_a = batch_a.coefficients;
+    uint64_t width_b = batch_b.coefficients;
+    big_int_batch result(count, width_a + width_b);
+
+    for_each_block(count, [&](uint64_t first, uint64_t last)
+                   {
+                       uint64_t lanes = last - first;
+
+                       // Multiply the magnitudes, a mask of all ones marks a negative integer
+                       vector<uint32_t> mask_a(lanes);
+                       vector<uint32_t> mask_b(lanes);
+                       vector<uint32_t> magnitude_a(width_a * lanes);
+                       vector<uint32_t> magnitude_b(width_b * lanes);
+                       vector<uint32_t> carry(lanes);
+                       const big_int_batch *batches[2] = {&batch_a, &batch_b};
+                       vector<uint32_t> *masks[2] = {&mask_a, &mask_b};
+                       vector<uint32_t> *magnitudes[2] = {&magnitude_a, &magnitude_b};
+                       for (uint64_t operand = 0; operand < 2; operand++)
+                       {
+                           const big_int_batch &batch = *batches[operand];
+                           uint32_t *mask = masks[operand]->data();
+                           uint32_t *magnitude = magnitudes[operand]->data();
+                           const uint32_t *top = batch.limbs.data() + (batch.coefficients - 1) * count + first;
+                           for (uint64_t i = 0; i < lanes; i++)
+                           {
+                               mask[i] = 0 - (top[i] >> 31);
+                               carry[i] = mask[i] & 1;
+                           }
+                           for (uint64_t j = 0; j < batch.coefficients; j++)
+                           {
+                               const uint32_t *digits = batch.limbs.data() + j * count + first;
+                               for (uint64_t i = 0; i < lanes; i++)
+                               {
+                                   uint64_t temp = (uint64_t)(digits[i] ^ mask[i]) + carry[i];
+                                   magnitude[j * lanes + i] = (uint32_t)temp;
+                                   carry[i] = (uint32_t)(temp >> 32);
+                               }
+                           }
+                       }
+
+                       // Schoolbook multiplication of every lane at once, one row of the first operand at a time
+                       vector<uint32_t> product((width_a + width_b) * lanes, 0);
+                       for (uint64_t ja = 0; ja < width_a; ja++)
+                       {
+                           fill(carry.begin(), carry.end(), 0);
+                           const uint32_t *digits_a = magnitude_a.data() + ja * lanes;
+                           for (uint64_t jb = 0; jb < width_b; jb++)
+                           {
+                               const uint32_t *digits_b = magnitude_b.data() + jb * lanes;
+                               uint32_t *out = product.data() + (ja + jb) * lanes;
+                               for (uint64_t i = 0; i < lanes; i++)
+                               {
+                                   uint64_t temp = (uint64_t)digits_a[i] * digits_b[i] + out[i] + carry[i];
+                                   out[i] = (uint32_t)temp;
+                                   carry[i] = (uint32_t)(temp >> 32);
+                               }
+                           }
+                           uint32_t *out = product.data() + (ja + width_b) * lanes;
+                           for (uint64_t i = 0; i < lanes; i++)
+                           {
+                               out[i] = carry[i];
+                           }
+                       }
+
+                       // Negate the products whose operands have different signs
+                       for (uint64_t i = 0; i < lanes; i++)
+                       {
+                           mask_a[i] ^= mask_b[i];
+                           carry[i] = mask_a[i] & 1;
+                       }
+                       for (uint64_t j = 0; j < width_a + width_b; j++)
+                       {
+                           uint32_t *out = result.limbs.data() + j * count + first;
+                           for (uint64_t i = 0; i < lanes; i++)
+                           {
+                               uint64_t temp = (uint64_t)(product[j * lanes + i] ^ mask_a[i]) + carry[i];
+                               out[i] = (uint32_t)temp;
+                               carry[i] = (uint32_t)(temp >> 32);
+                           }
+                       } });
+    return result;
+}
+
+vector<int8_t> compare(const big_int_batch &batch_a, const big_int_batch &batch_b)
+{
+    if (batch_a.count != batch_b.count)
+    {
+        throw batch_size_mismatch();
+    }
+
+    uint64_t count = batch_a.count;
+    uint64_t width = max(batch_a.coefficients, batch_b.coefficients);
+    vector<int8_t> result(count, 0);
+    vector<uint32_t> extension_a = batch_a.sign_extension();
+    vector<uint32_t> extension_b = batch_b.sign_extension();
+
+    for_each_block(count, [&](uint64_t first, uint64_t last)
+                   {
+                       uint64_t lanes = last - first;
+                       int8_t *order = result.data() + first;
+
+                       // The most significant coefficients are compared as signed integers
+                       const uint32_t *top_a = batch_a.row(width - 1, extension_a) + first;
+                       const uint32_t *top_b = batch_b.row(width - 1, extension_b) + first;
+                       for (uint64_t i = 0; i < lanes; i++)
+                       {
+                           int32_t digit_a = (int32_t)top_a[i];
+                           int32_t digit_b = (int32_t)top_b[i];
+                           order[i] = (int8_t)((digit_a > digit_b) - (digit_a < digit_b));
+                       }
+
+                       // The first coefficient that differs decides the order of a lane
+                       for (uint64_t j = width - 1; j > 0; j--)
+                       {
+                           const uint32_t *digits_a = batch_a.row(j - 1, extension_a) + first;
+                           const uint32_t *digits_b = batch_b.row(j - 1, extension_b) + first;
+                           for (uint64_t i = 0; i < lanes; i++)
+                           {
+                               int8_t digit_order = (int8_t)((digits_a[i] > digits_b[i]) - (digits_a[i] < digits_b[i]));
+                               order[i] = order[i] != 0 ? order[i] : digit_order;
+                           }
+                       } });
+    return result;
+}
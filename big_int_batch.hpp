@@ -0,0 +1,165 @@
+#pragma once
+/**
+ * @file big_int_batch.hpp
+ * @author Gabrielle Ching-Johnson
+ * @brief Header file for a container that stores many big integers of the same width in one structure of arrays
+ * @version 0.3
+ * @date Oct 18, 2026
+ */
+
+#include <vector>
+#include <cstdint>
+#include <stdexcept>
+#include "big_int.hpp"
+using namespace std;
+
+/**
+ * @brief This class stores many big integers with the same number of coefficients in one contiguous array
+ * @details The integers are stored in two's complement with width coefficients each, and coefficient j of integer i
+ *          is stored at index j * size + i (structure of arrays). Thus the same coefficient of neighbouring integers
+ *          is next to each other in memory, and the batch operations run the same carry loop for every integer
+ *          (lane) at once, which the compiler turns into SIMD instructions. Large batches are split into blocks of
+ *          lanes that run in parallel on the threads set with set_big_int_threads() (see thread_pool.hpp).
+ */
+class big_int_batch
+{
+public:
+    /**
+     * @brief Initialize a batch of integers with value 0
+     * @param count The number of integers
+     * @param width The number of coefficients of each integer, including the sign bit, at least 1
+     */
+    big_int_batch(const uint64_t &count, const uint64_t &width);
+
+    /**
+     * @brief Initialize a batch from big integers
+     * @details Throws batch_width_overflow if an integer does not fit in width coefficients
+     * @param integers The big_ints to store
+     * @param width The number of coefficients of each integer, 0 uses the smallest width that fits every integer
+     */
+    explicit big_int_batch(const vector<big_int> &integers, const uint64_t &width = 0);
+
+    /**
+     * @brief Gets the number of integers in the batch
+     * @return The number of integers
+     */
+    uint64_t size() const;
+
+    /**
+     * @brief Gets the number of coefficients of each integer
+     * @return The number of coefficients
+     */
+    uint64_t width() const;
+
+    /**
+     * @brief Stores a big integer in the batch
+     * @details Throws batch_width_overflow if the integer does not fit in width coefficients
+     * @param index The index of the integer in the batch
+     * @param integer The big_int to store
+     */
+    void set(const uint64_t &index, const big_int &integer);
+
+    /**
+     * @brief Gets an integer of the batch
+     * @param index The index of the integer in the batch
+     * @return The big_int stored at the index
+     */
+    big_int get(const uint64_t &index) const;
+
+    /**
+     * @brief Gets every integer of the batch
+     * @return A vector of the big_ints of the batch
+     */
+    vector<big_int> to_big_ints() const;
+
+    /**
+     * @brief Adds two batches element-wise
+     * @details The batches must have the same size (else batch_size_mismatch is thrown), the result has one more
+     *          coefficient than the wider batch so the sums can not overflow
+     * @param batch_a The first batch to add
+     * @param batch_b The second batch to add
+     * @return A batch with the sums
+     */
+    friend big_int_batch operator+(const big_int_batch &batch_a, const big_int_batch &batch_b);
+
+    /**
+     * @brief Subtracts two batches element-wise
+     * @details The batches must have the same size (else batch_size_mismatch is thrown), the result has one more
+     *          coefficient than the wider batch
+     * @param batch_a The batch to subtract from
+     * @param batch_b The batch to subtract
+     * @return A batch with the differences
+     */
+    friend big_int_batch operator-(const big_int_batch &batch_a, const big_int_batch &batch_b);
+
+    /**
+     * @brief Multiplies two batches element-wise
+     * @details The batches must have the same size (else batch_size_mismatch is thrown), the result is as wide as
+     *          both batches together
+     * @param batch_a The first batch to multiply
+     * @param batch_b The second batch to multiply
+     * @return A batch with the products
+     */
+    friend big_int_batch operator*(const big_int_batch &batch_a, const big_int_batch &batch_b);
+
+    /**
+     * @brief Compares two batches element-wise
+     * @details The batches must have the same size (else batch_size_mismatch is thrown)
+     * @param batch_a The first batch to compare
+     * @param batch_b The second batch to compare
+     * @return For each pair -1 if the integer of batch_a is less, 0 if they are equal and 1 if it is greater
+     */
+    friend vector<int8_t> compare(const big_int_batch &batch_a, const big_int_batch &batch_b);
+
+private:
+    // Number of integers (lanes)
+    uint64_t count;
+
+    // Number of coefficients of each integer
+    uint64_t coefficients;
+
+    // Coefficient j of integer i is at index j * count + i
+    vector<uint32_t> limbs;
+
+    /**
+     * @brief Gets the coefficients of one position of every integer, or of the sign extension above the width
+     * @param position The index of the coefficient
+     * @param extension The sign extension of every integer, used when position is at least the width
+     * @return A pointer to count coefficients
+     */
+    const uint32_t *row(const uint64_t &position, const vector<uint32_t> &extension) const;
+
+    /**
+     * @brief Gets the sign extension coefficient (0 or 2^32 - 1) of every integer
+     * @return A vector with the sign extension of every integer
+     */
+    vector<uint32_t> sign_extension() const;
+
+    /**
+     * @brief Adds or subtracts two batches element-wise in two's complement
+     * @param batch_a The first batch
+     * @param batch_b The second batch
+     * @param subtract True if batch_b is subtracted from batch_a
+     * @return A batch with the sums or differences
+     */
+    static big_int_batch add_or_subtract(const big_int_batch &batch_a, const big_int_batch &batch_b, const bool &subtract);
+};
+
+/***************************** Exceptions ***************************/
+/**
+ * @brief Exception to be thrown if a big integer does not fit in the width of a batch
+ */
+class batch_width_overflow : public invalid_argument
+{
+public:
+    batch_width_overflow() : invalid_argument("The big integer does not fit in the number of coefficients of the batch"){};
+};
+
+/**
+ * @brief Exception to be thrown if two batches with a different number of integers are combined
+ */
+class batch_size_mismatch : public invalid_argument
+{
+public:
+    batch_size_mismatch() : invalid_argument("The batches must contain the same number of big integers"){};
+};
@@ -0,0 +1,404 @@
+/**
+ * @file big_int_bench.cpp
+ * @author Gabrielle Ching-Johnson
+ * @brief C++ code file for the harness that times big_int operations and reports the results in JSON
+ * @version 0.3
+ * @date Oct 18, 2026
+ */
+
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <random>
+#include <algorithm>
+#include <iomanip>
+#include <functional>
+#include <iostream>
+#include "big_int_bench.hpp"
+#include "big_int.hpp"
+#include "big_int_random.hpp"
+#include "big_int_intern.hpp"
+#include "big_int_stats.hpp"
+#include "thread_pool.hpp"
+using namespace std;
+
+/******************************* Allocation Counting ******************************/
+#ifdef BIG_INT_INSTRUMENT
+// The instrumented library replaces operator new itself, only the allocations of the big_int operations are counted
+uint64_t allocation_count()
+{
+    big_int_stats stats = big_int_stats_snapshot();
+    uint64_t total = 0;
+    for (const big_int_operation_stats &operation : stats.operations)
+    {
+        total += operation.allocations;
+    }
+    return total;
+}
+#else
+// Number of calls of the global operator new
+static atomic<uint64_t> allocations{0};
+
+void *operator new(size_t size)
+{
+    allocations.fetch_add(1, memory_order_relaxed);
+    void *memory = malloc(size == 0 ? 1 : size);
+    if (memory == nullptr)
+    {
+        throw bad_alloc();
+    }
+    return memory;
+}
+
+void operator delete(void *memory) noexcept
+{
+    free(memory);
+}
+
+void operator delete(void *memory, size_t) noexcept
+{
+    free(memory);
+}
+
+uint64_t allocation_count()
+{
+    return allocations.load(memory_order_relaxed);
+}
+#endif
+
+/**
+ * @brief Creates a positive big integer with random coefficients, the most significant one is not zero
+ * @param limbs The number of coefficients
+ * @param seed The seed of the random numbers, the same seed gives the same integer
+ * @return The big_int
+ */
+static big_int random_integer(const uint64_t &limbs, const uint64_t &seed)
+{
+    mt19937_64 generator(seed);
+    vector<uint32_t> digits(limbs);
+    for (uint32_t &digit : digits)
+    {
+        digit = (uint32_t)generator();
+    }
+    digits[0] |= 1;
+    return big_int(digits);
+}
+
+// Results of the timed operations are stored here so the compiler can not remove the operations
+static volatile bool bool_sink;
+static volatile uint64_t size_sink;
+
+/******************************* Benchmarks ******************************/
+vector<bench_case> big_int_benchmarks()
+{
+    vector<bench_case> benchmarks;
+
+    // The memory bound operations (copy, add, subtract and the comparisons) have noisier timings, the regression
+    // gate accepts 20% slower times for them
+
+    benchmarks.push_back({"copy", 1000000, [](const uint64_t &limbs)
+                          {
+                              big_int a = random_integer(limbs, 1);
+                              return function<void()>([a]
+                                                      { big_int copy(a);
+                                                        size_sink = copy.coefficient_size(); });
+                          }, 0.2});
+
+    benchmarks.push_back({"construct_string", 10000, [](const uint64_t &limbs)
+                          {
+                              string digits = print_base10(random_integer(limbs, 2));
+                              return function<void()>([digits]
+                                                      { big_int parsed(digits);
+                                                        size_sink = parsed.coefficient_size(); });
+                          }});
+
+    benchmarks.push_back({"print_base10", 10000, [](const uint64_t &limbs)
+                          {
+                              big_int a = random_integer(limbs, 3);
+                              return function<void()>([a]
+                                                      { size_sink = print_base10(a).size(); });
+                          }});
+
+    benchmarks.push_back({"add", 1000000, [](const uint64_t &limbs)
+                          {
+                              big_int a = random_integer(limbs, 4);
+                              big_int b = random_integer(limbs, 5);
+                              return function<void()>([a, b]
+                                                      { big_int sum = a + b;
+                                                        size_sink = sum.coefficient_size(); });
+                          }, 0.2});
+
+    benchmarks.push_back({"subtract", 1000000, [](const uint64_t &limbs)
+                          {
+                              big_int a = random_integer(limbs, 6);
+                              big_int b = random_integer(limbs, 7);
+                              return function<void()>([a, b]
+                                                      { big_int difference = a - b;
+                                                        size_sink = difference.coefficient_size(); });
+                          }, 0.2});
+
+    benchmarks.push_back({"multiply", 100000, [](const uint64_t &limbs)
+                          {
+                              big_int a = random_integer(limbs, 8);
+                              big_int b = random_integer(limbs, 9);
+                              return function<void()>([a, b]
+                                                      { big_int product = a * b;
+                                                        size_sink = product.coefficient_size(); });
+                          }});
+
+    // A dividend of twice the size of the divisor, the quotient and the divisor have the same size
+    benchmarks.push_back({"divide", 10000, [](const uint64_t &limbs)
+                          {
+                              big_int b = random_integer(limbs, 10);
+                              big_int a = random_integer(2 * limbs, 16);
+                              return function<void()>([a, b]
+                                                      { big_int quotient = a / b;
+                                                        size_sink = quotient.coefficient_size(); });
+                          }});
+
+    benchmarks.push_back({"less_than", 1000000, [](const uint64_t &limbs)
+                          {
+                              // Equal except the least significant coefficient, every coefficient is compared
+                              big_int a = random_integer(limbs, 11);
+                              big_int b = a + 1;
+                              return function<void()>([a, b]
+                                                      { bool_sink = a < b; });
+                          }, 0.2});
+
+    benchmarks.push_back({"equal", 1000000, [](const uint64_t &limbs)
+                          {
+                              big_int a = random_integer(limbs, 12);
+                              big_int b(a);
+                              return function<void()>([a, b]
+                                                      { bool_sink = a == b; });
+                          }, 0.2});
+
+    benchmarks.push_back({"hash", 1000000, [](const uint64_t &limbs)
+                          {
+                              big_int a = random_integer(limbs, 21);
+                              return function<void()>([a]
+                                                      { size_sink = hash<big_int>{}(a); });
+                          }, 0.2});
+
+    // Interning a value that is already in the shared table, the lookup of a cache of constants
+    benchmarks.push_back({"intern", 1000000, [](const uint64_t &limbs)
+                          {
+                              big_int a = random_integer(limbs, 22);
+                              intern(a);
+                              return function<void()>([a]
+                                                      { size_sink = intern(a).use_count(); });
+                          }, 0.2});
+
+    benchmarks.push_back({"to_string_hex", 1000000, [](const uint64_t &limbs)
+                          {
+                              big_int a = random_integer(limbs, 13);
+                              return function<void()>([a]
+                                                      { size_sink = a.to_string(16).size(); });
+                          }});
+
+    benchmarks.push_back({"from_string_hex", 1000000, [](const uint64_t &limbs)
+                          {
+                              string digits = random_integer(limbs, 14).to_string(16);
+                              return function<void()>([digits]
+                                                      { size_sink = big_int::from_string(digits, 16).coefficient_size(); });
+                          }});
+
+    benchmarks.push_back({"to_chars", 10000, [](const uint64_t &limbs)
+                          {
+                              big_int a = random_integer(limbs, 15);
+                              vector<char> buffer(to_chars_size(a));
+                              return function<void()>([a, buffer]() mutable
+                                                      { size_sink = (uint64_t)(to_chars(buffer.data(), buffer.data() + buffer.size(), a).ptr - buffer.data()); });
+                          }});
+
+    benchmarks.push_back({"random_bits", 1000000, [](const uint64_t &limbs)
+                          {
+                              xoshiro256_engine generator(17);
+                              return function<void()>([limbs, generator]() mutable
+                                                      { size_sink = random_bits(32 * limbs, generator).coefficient_size(); });
+                          }});
+
+    // Operations with a built in integer, the increment is done in place without allocating
+    benchmarks.push_back({"increment", 1000000, [](const uint64_t &limbs)
+                          {
+                              big_int a = random_integer(limbs, 18);
+                              return function<void()>([a]() mutable
+                                                      { a += 1;
+                                                        size_sink = a.coefficient_size(); });
+                          }, 0.2});
+
+    benchmarks.push_back({"multiply_int", 1000000, [](const uint64_t &limbs)
+                          {
+                              big_int a = random_integer(limbs, 19);
+                              return function<void()>([a]
+                                                      { big_int product = a * 1000000007;
+                                                        size_sink = product.coefficient_size(); });
+                          }, 0.2});
+
+    benchmarks.push_back({"remainder_int", 1000000, [](const uint64_t &limbs)
+                          {
+                              big_int a = random_integer(limbs, 20);
+                              return function<void()>([a]
+                                                      { big_int remainder = a % 1000000007;
+                                                        size_sink = remainder.coefficient_size(); });
+                          }});
+
+    return benchmarks;
+}
+
+vector<uint64_t> bench_sizes(const uint64_t &max_limbs)
+{
+    vector<uint64_t> sizes;
+    for (uint64_t limbs = 1; limbs <= max_limbs; limbs *= 10)
+    {
+        sizes.push_back(limbs);
+    }
+    return sizes;
+}
+
+/******************************* Running ******************************/
+bench_result run_benchmark(const bench_case &benchmark, const uint64_t &limbs, const bench_options &options)
+{
+    using clock = chrono::steady_clock;
+    function<void()> operation = benchmark.setup(limbs);
+
+    // Warm up the caches and find how many iterations take min_time
+    uint64_t iterations = 1;
+    while (true)
+    {
+        clock::time_point start = clock::now();
+        for (uint64_t i = 0; i < iterations; i++)
+        {
+            operation();
+        }
+        double seconds = chrono::duration<double>(clock::now() - start).count();
+        if (seconds >= options.min_time)
+        {
+            break;
+        }
+        // Aim a little above min_time, at most 10 times more iterations per step
+        double scale = seconds > 0 ? 1.2 * options.min_time / seconds : 10.0;
+        iterations = max(iterations + 1, (uint64_t)((double)iterations * min(scale, 10.0)));
+    }
+
+    bench_result result;
+    result.name = benchmark.name;
+    result.limbs = limbs;
+    result.iterations = iterations;
+    uint64_t first_allocation = allocation_count();
+    for (uint64_t repetition = 0; repetition < options.repetitions; repetition++)
+    {
+        clock::time_point start = clock::now();
+        for (uint64_t i = 0; i < iterations; i++)
+        {
+            operation();
+        }
+        double nanoseconds = chrono::duration<double, nano>(clock::now() - start).count();
+        result.samples.push_back(nanoseconds / (double)iterations);
+    }
+    uint64_t operations = iterations * options.repetitions;
+    result.allocations_per_op = (double)(allocation_count() - first_allocation) / (double)operations;
+
+    // Statistics of the repetitions
+    vector<double> sorted = result.samples;
+    sort(sorted.begin(), sorted.end());
+    double sum = 0;
+    for (const double &sample : sorted)
+    {
+        sum += sample;
+    }
+    result.mean = sum / (double)sorted.size();
+    result.median = sorted.size() % 2 == 1 ? sorted[sorted.size() / 2] : (sorted[sorted.size() / 2 - 1] + sorted[sorted.size() / 2]) / 2;
+    result.min = sorted.front();
+    result.max = sorted.back();
+    double squares = 0;
+    for (const double &sample : sorted)
+    {
+        squares += (sample - result.mean) * (sample - result.mean);
+    }
+    result.stddev = sorted.size() > 1 ? sqrt(squares / (double)(sorted.size() - 1)) : 0;
+    result.limbs_per_second = (double)limbs / result.mean * 1e9;
+    return result;
+}
+
+vector<bench_result> run_benchmarks(const vector<bench_case> &benchmarks, const bench_options &options, ostream &progress)
+{
+    vector<bench_result> results;
+    for (const bench_case &benchmark : benchmarks)
+    {
+        if (benchmark.name.find(options.filter) == string::npos)
+        {
+            continue;
+        }
+        uint64_t max_limbs = options.full ? options.max_limbs : min(options.max_limbs, benchmark.max_limbs);
+        for (const uint64_t &limbs : bench_sizes(max_limbs))
+        {
+            results.push_back(run_benchmark(benchmark, limbs, options));
+            const bench_result &result = results.back();
+            progress << left << setw(18) << result.name << right << setw(9) << result.limbs << " limbs "
+                     << setw(16) << fixed << setprecision(1) << result.mean << " ns/op  +- "
+                     << setw(5) << setprecision(1) << (result.mean > 0 ? 100 * result.stddev / result.mean : 0) << "%  "
+                     << setprecision(2) << result.allocations_per_op << " allocations/op\n";
+            progress.flush();
+        }
+    }
+    return results;
+}
+
+/**
+ * @brief Escapes a string for JSON
+ * @param text The string
+ * @return The string in quotes with ", \ and control characters escaped
+ */
+static string json_string(const string &text)
+{
+    string escaped = "\"";
+    for (const char &character : text)
+    {
+        if (character == '"' || character == '\\')
+        {
+            escaped += '\\';
+            escaped += character;
+        }
+        else if ((unsigned char)character < 0x20)
+        {
+            escaped += ' ';
+        }
+        else
+        {
+            escaped += character;
+        }
+    }
+    return escaped + "\"";
+}
+
+void write_json(ostream &out, const vector<bench_result> &results, const bench_options &options)
+{
+    out << setprecision(17) << defaultfloat;
+    out << "{\n";
+    out << "  \"context\": {\"threads\": " << big_int_thread_pool().size() << ", \"min_time\": " << options.min_time
+        << ", \"repetitions\": " << options.repetitions << ", \"max_limbs\": " << options.max_limbs << ", \"full\": " << (options.full ? "true" : "false") << "},\n";
+    out << "  \"benchmarks\": [";
+    for (uint64_t i = 0; i < results.size(); i++)
+    {
+        const bench_result &result = results[i];
+        out << (i == 0 ? "\n" : ",\n");
+        out << "    {\"name\": " << json_string(result.name) << ", \"limbs\": " << result.limbs
+            << ", \"iterations\": " << result.iterations << ", \"ns_per_op\": {\"mean\": " << result.mean
+            << ", \"median\": " << result.median << ", \"min\": " << result.min << ", \"max\": " << result.max
+            << ", \"stddev\": " << result.stddev << ", \"variance\": " << result.stddev * result.stddev
+            << ", \"samples\": [";
+        for (uint64_t j = 0; j < result.samples.size(); j++)
+        {
+            out << (j == 0 ? "" : ", ") << result.samples[j];
+        }
+        out << "]}, \"limbs_per_second\": " << result.limbs_per_second << ", \"allocations_per_op\": "
+            << result.allocations_per_op << "}";
+    }
+    out << "\n  ]\n}\n";
+}
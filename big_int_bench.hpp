@@ -0,0 +1,140 @@
+#pragma once
+/**
+ * @file big_int_bench.hpp
+ * @author Gabrielle Ching-Johnson
+ * @brief Header file for the harness that times big_int operations and reports the results in JSON
+ * @version 0.3
+ * @date Oct 18, 2026
+ */
+
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+using namespace std;
+
+/*
+ * Each benchmark times one operation on operands of a number of coefficients (limbs). The operation is run a few
+ * times as a warmup, then the number of iterations is chosen so one repetition takes at least min_time seconds and
+ * the repetitions are timed separately to find the mean, median, minimum and standard deviation of the time per
+ * operation. The memory allocations are counted by replacing the global operator new in big_int_bench.cpp, thus
+ * every program that links the harness counts its allocations.
+ */
+
+/**
+ * @brief Settings of a benchmark run
+ */
+struct bench_options
+{
+    // Largest number of coefficients of the operands
+    uint64_t max_limbs = 1000000;
+
+    // Minimum time in seconds of one repetition
+    double min_time = 0.05;
+
+    // Number of timed repetitions of each benchmark
+    uint64_t repetitions = 5;
+
+    // Only the benchmarks whose name contains this string are run
+    string filter;
+
+    // True to ignore the largest size of each benchmark (ie multiply 10^6 coefficients)
+    bool full = false;
+};
+
+/**
+ * @brief A timed operation
+ */
+struct bench_case
+{
+    // Name of the operation
+    string name;
+
+    // Largest number of coefficients the operation is timed at unless the run is full, slow operations stop earlier
+    uint64_t max_limbs;
+
+    // Creates the operands for a number of coefficients and returns the operation to time
+    function<function<void()>(const uint64_t &limbs)> setup;
+
+    // Largest slowdown of the fastest repetition (ie 0.1 is 10%) the regression gate accepts, memory bound operations
+    // are noisier and get more
+    double tolerance = 0.1;
+};
+
+/**
+ * @brief The result of a benchmark
+ */
+struct bench_result
+{
+    // Name of the operation
+    string name;
+
+    // Number of coefficients of the operands
+    uint64_t limbs = 0;
+
+    // Number of operations in each repetition
+    uint64_t iterations = 0;
+
+    // Nanoseconds per operation of each repetition
+    vector<double> samples;
+
+    // Statistics of the samples
+    double mean = 0;
+    double median = 0;
+    double min = 0;
+    double max = 0;
+    double stddev = 0;
+
+    // Coefficients of the operands processed per second (limbs / mean time)
+    double limbs_per_second = 0;
+
+    // Memory allocations per operation
+    double allocations_per_op = 0;
+};
+
+/**
+ * @brief Gets the number of memory allocations made by the program so far
+ * @return The number of calls of the global operator new
+ */
+uint64_t allocation_count();
+
+/**
+ * @brief Gets the benchmarks of every big_int operation (construction, print_base10, +, -, *, /, comparisons and
+ *        conversions)
+ * @return The benchmarks
+ */
+vector<bench_case> big_int_benchmarks();
+
+/**
+ * @brief Gets the sizes of the operands of a sweep, the powers of 10 up to a maximum
+ * @param max_limbs The largest number of coefficients
+ * @return 1, 10, 100, ... up to max_limbs
+ */
+vector<uint64_t> bench_sizes(const uint64_t &max_limbs);
+
+/**
+ * @brief Times an operation at one size
+ * @param benchmark The operation
+ * @param limbs The number of coefficients of the operands
+ * @param options The settings of the run
+ * @return The statistics of the repetitions
+ */
+bench_result run_benchmark(const bench_case &benchmark, const uint64_t &limbs, const bench_options &options);
+
+/**
+ * @brief Times every operation that matches the filter at every size of its sweep
+ * @param benchmarks The operations
+ * @param options The settings of the run
+ * @param progress The stream to report each result to as it finishes
+ * @return The results
+ */
+vector<bench_result> run_benchmarks(const vector<bench_case> &benchmarks, const bench_options &options, ostream &progress);
+
+/**
+ * @brief Writes the results of a run in JSON
+ * @param out The stream to write to
+ * @param results The results
+ * @param options The settings of the run
+ */
+void write_json(ostream &out, const vector<bench_result> &results, const bench_options &options);
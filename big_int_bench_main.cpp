@@ -0,0 +1,90 @@
+/**
+ * @file big_int_bench_main.cpp
+ * @author Gabrielle Ching-Johnson
+ * @brief Program that times every big_int operation across operand sizes and writes the results in JSON
+ * @version 0.3
+ * @date Oct 18, 2026
+ *
+ * Usage: big_int_bench [--max-limbs=N] [--min-time=SECONDS] [--repetitions=N] [--filter=NAME] [--threads=N]
+ *                      [--full] [--output=FILE]
+ */
+
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <stdexcept>
+#include "big_int_bench.hpp"
+#include "thread_pool.hpp"
+using namespace std;
+
+/**
+ * @brief Gets the value of a command line option of the form --name=value
+ * @param argument The command line argument
+ * @param name The name of the option with its dashes and equal sign (ie --max-limbs=)
+ * @param value Set to the value of the option if the argument is the option
+ * @return True if the argument is the option
+ */
+static bool option_value(const string &argument, const string &name, string &value)
+{
+    if (argument.compare(0, name.size(), name) != 0)
+    {
+        return false;
+    }
+    value = argument.substr(name.size());
+    return true;
+}
+
+int main(int argc, char *argv[])
+{
+    bench_options options;
+    string output;
+    try
+    {
+        for (int i = 1; i < argc; i++)
+        {
+            string argument = argv[i];
+            string value;
+            if (option_value(argument, "--max-limbs=", value))
+                options.max_limbs = stoull(value);
+            else if (option_value(argument, "--min-time=", value))
+                options.min_time = stod(value);
+            else if (option_value(argument, "--repetitions=", value))
+                options.repetitions = max(stoull(value), 1ULL);
+            else if (option_value(argument, "--filter=", value))
+                options.filter = value;
+            else if (option_value(argument, "--threads=", value))
+                set_big_int_threads(stoull(value));
+            else if (option_value(argument, "--output=", value))
+                output = value;
+            else if (argument == "--full")
+                options.full = true;
+            else
+                throw invalid_argument("Unknown option " + argument);
+        }
+    }
+    catch (const exception &e)
+    {
+        cerr << e.what() << "\nUsage: big_int_bench [--max-limbs=N] [--min-time=SECONDS] [--repetitions=N] "
+             << "[--filter=NAME] [--threads=N] [--full] [--output=FILE]\n";
+        return 2;
+    }
+
+    // The progress goes to the error stream so the JSON can be redirected on its own
+    vector<bench_result> results = run_benchmarks(big_int_benchmarks(), options, cerr);
+    if (output.empty())
+    {
+        write_json(cout, results, options);
+        return 0;
+    }
+
+    ofstream file(output);
+    write_json(file, results, options);
+    if (!file)
+    {
+        cerr << "Could not write " << output << "\n";
+        return 1;
+    }
+    return 0;
+}
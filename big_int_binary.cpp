@@ -0,0 +1,337 @@
+/**
+ * @file big_int_binary.cpp
+ * @author Gabrielle Ching-Johnson
+ * @brief C++ code file for reading and writing big integers in a compact binary format, and memory mapped read only views
+ * @version 0.3
+ * @date Oct 18, 2026
+ */
+
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
+#include <bit>
+#include <span>
+#include "big_int_binary.hpp"
+#ifdef BIG_INT_MAPPED_VIEW
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+using namespace std;
+
+// The magic characters at the start of the binary format
+static const char binary_magic[4] = {'B', 'I', 'N', 'T'};
+
+// Number of coefficients read from a stream at a time, so a corrupt size can not allocate more than is read
+static const uint64_t read_chunk = 1 << 20;
+
+/**
+ * @brief Stores an unsigned integer in little endian byte order
+ * @param destination The bytes to write to
+ * @param value The integer
+ * @param bytes The number of bytes to write
+ */
+static void store_little_endian(unsigned char *destination, const uint64_t &value, const uint64_t &bytes)
+{
+    for (uint64_t i = 0; i < bytes; i++)
+    {
+        destination[i] = (unsigned char)(value >> (8 * i));
+    }
+}
+
+/**
+ * @brief Loads an unsigned integer stored in little endian byte order
+ * @param source The bytes to read
+ * @param bytes The number of bytes to read
+ * @return The integer
+ */
+static uint64_t load_little_endian(const unsigned char *source, const uint64_t &bytes)
+{
+    uint64_t value = 0;
+    for (uint64_t i = 0; i < bytes; i++)
+    {
+        value |= (uint64_t)source[i] << (8 * i);
+    }
+    return value;
+}
+
+/**
+ * @brief Checks the header of the binary format and reads the sign and number of coefficients
+ * @details Throws the exception invalid_binary_integer if the header is not valid
+ * @param header The first big_int_binary_header_size bytes
+ * @param negative Set to true if the integer is negative
+ * @return The number of coefficients
+ */
+static uint64_t read_header(const unsigned char *header, bool &negative)
+{
+    uint64_t flags = load_little_endian(header + 4, 4);
+    uint64_t size = load_little_endian(header + 8, 8);
+    if (memcmp(header, binary_magic, 4) != 0 || flags > 1 || size == 0)
+    {
+        throw invalid_binary_integer();
+    }
+    negative = flags == 1;
+    return size;
+}
+
+/******************************* Reading and Writing ******************************/
+void write_binary(ostream &out, const big_int &integer)
+{
+    unsigned char header[big_int_binary_header_size];
+    memcpy(header, binary_magic, 4);
+    store_little_endian(header + 4, integer.integer_sign == sign::NEGATIVE && !integer.is_zero() ? 1 : 0, 4);
+    store_little_endian(header + 8, integer.coefficient.size(), 8);
+    out.write((const char *)header, big_int_binary_header_size);
+
+    // The coefficients are already little endian in memory, write them with a single copy
+    if constexpr (endian::native == endian::little)
+    {
+        out.write((const char *)integer.coefficient.data(), (streamsize)(integer.coefficient.size() * sizeof(uint32_t)));
+    }
+    else
+    {
+        unsigned char bytes[sizeof(uint32_t)];
+        for (const uint32_t &digit : integer.coefficient)
+        {
+            store_little_endian(bytes, digit, sizeof(uint32_t));
+            out.write((const char *)bytes, sizeof(uint32_t));
+        }
+    }
+}
+
+big_int read_binary(istream &in)
+{
+    unsigned char header[big_int_binary_header_size];
+    if (!in.read((char *)header, big_int_binary_header_size))
+    {
+        throw invalid_binary_integer();
+    }
+    bool negative = false;
+    uint64_t size = read_header(header, negative);
+
+    big_int result;
+    result.coefficient.clear();
+    while (result.coefficient.size() < size)
+    {
+        uint64_t first = result.coefficient.size();
+        uint64_t count = min(read_chunk, size - first);
+        result.coefficient.resize(first + count);
+        if (!in.read((char *)(result.coefficient.data() + first), (streamsize)(count * sizeof(uint32_t))))
+        {
+            throw invalid_binary_integer();
+        }
+    }
+
+    if constexpr (endian::native != endian::little)
+    {
+        for (uint32_t &digit : result.coefficient)
+        {
+            digit = (uint32_t)load_little_endian((const unsigned char *)&digit, sizeof(uint32_t));
+        }
+    }
+    result.integer_sign = negative ? sign::NEGATIVE : sign::POSITIVE;
+    result.normalize();
+    return result;
+}
+
+void save_binary(const string &path, const big_int &integer)
+{
+    ofstream out(path, ios::binary | ios::trunc);
+    if (!out)
+    {
+        throw big_int_file_error(path);
+    }
+    write_binary(out, integer);
+    out.close();
+    if (!out)
+    {
+        throw big_int_file_error(path);
+    }
+}
+
+big_int load_binary(const string &path)
+{
+    ifstream in(path, ios::binary);
+    if (!in)
+    {
+        throw big_int_file_error(path);
+    }
+    return read_binary(in);
+}
+
+/******************************* Memory Mapped Views ******************************/
+#ifdef BIG_INT_MAPPED_VIEW
+// The coefficient of a view without a file (ie moved from), its value is zero
+static const uint32_t zero_digit = 0;
+
+big_int_view::big_int_view(const string &path)
+{
+    // The coefficients are used in place, thus they must have the byte order of the machine
+    if constexpr (endian::native != endian::little)
+    {
+        throw big_int_file_error(path);
+    }
+
+    int file = open(path.c_str(), O_RDONLY);
+    if (file < 0)
+    {
+        throw big_int_file_error(path);
+    }
+    struct stat status;
+    if (fstat(file, &status) != 0 || (uint64_t)status.st_size < big_int_binary_header_size)
+    {
+        close(file);
+        throw big_int_file_error(path);
+    }
+    mapping_size = (uint64_t)status.st_size;
+    mapping = mmap(nullptr, mapping_size, PROT_READ, MAP_PRIVATE, file, 0);
+
+    // The mapping stays valid after the file is closed
+    close(file);
+    if (mapping == MAP_FAILED)
+    {
+        mapping = nullptr;
+        throw big_int_file_error(path);
+    }
+    madvise(mapping, mapping_size, MADV_SEQUENTIAL);
+
+    const unsigned char *bytes = (const unsigned char *)mapping;
+    bool negative = false;
+    uint64_t size = 0;
+    try
+    {
+        size = read_header(bytes, negative);
+        if ((mapping_size - big_int_binary_header_size) / sizeof(uint32_t) < size)
+        {
+            throw invalid_binary_integer();
+        }
+    }
+    catch (const invalid_binary_integer &e)
+    {
+        unmap();
+        throw;
+    }
+
+    // The header is 16 bytes and the mapping is page aligned, thus the coefficients are aligned
+    const uint32_t *first = (const uint32_t *)(bytes + big_int_binary_header_size);
+    while (size > 1 && first[size - 1] == 0)
+    {
+        size--;
+    }
+    digits = span<const uint32_t>(first, size);
+    integer_sign = negative && !(size == 1 && first[0] == 0) ? sign::NEGATIVE : sign::POSITIVE;
+}
+
+big_int_view::big_int_view(big_int_view &&view) noexcept : mapping(view.mapping), mapping_size(view.mapping_size), digits(view.digits), integer_sign(view.integer_sign)
+{
+    view.mapping = nullptr;
+    view.mapping_size = 0;
+    view.digits = span<const uint32_t>(&zero_digit, 1);
+    view.integer_sign = sign::POSITIVE;
+}
+
+big_int_view &big_int_view::operator=(big_int_view &&view) noexcept
+{
+    if (this != &view)
+    {
+        unmap();
+        mapping = view.mapping;
+        mapping_size = view.mapping_size;
+        digits = view.digits;
+        integer_sign = view.integer_sign;
+        view.mapping = nullptr;
+        view.mapping_size = 0;
+        view.digits = span<const uint32_t>(&zero_digit, 1);
+        view.integer_sign = sign::POSITIVE;
+    }
+    return *this;
+}
+
+big_int_view::~big_int_view()
+{
+    unmap();
+}
+
+void big_int_view::unmap()
+{
+    if (mapping != nullptr)
+    {
+        munmap(mapping, mapping_size);
+        mapping = nullptr;
+    }
+}
+
+sign big_int_view::get_sign() const
+{
+    return integer_sign;
+}
+
+const uint32_t &big_int_view::at(const uint64_t &index) const
+{
+    if (index >= digits.size())
+    {
+        throw out_of_range("The index of the coefficient is out of range");
+    }
+    return digits[index];
+}
+
+uint64_t big_int_view::coefficient_size() const
+{
+    return digits.size();
+}
+
+span<const uint32_t> big_int_view::coefficients() const
+{
+    return digits;
+}
+
+big_int big_int_view::to_big_int() const
+{
+    big_int result;
+    result.coefficient.assign(digits.begin(), digits.end());
+    result.integer_sign = integer_sign;
+    return result;
+}
+
+int big_int_view::compare(const big_int &integer) const
+{
+    bool view_negative = integer_sign == sign::NEGATIVE;
+    bool integer_negative = integer.integer_sign == sign::NEGATIVE && !integer.is_zero();
+    if (view_negative != integer_negative)
+    {
+        return view_negative ? -1 : 1;
+    }
+
+    // Compare the magnitudes from the most significant coefficient, ignoring leading zeros of the big_int
+    uint64_t integer_size = integer.coefficient.size();
+    while (integer_size > 1 && integer.coefficient[integer_size - 1] == 0)
+    {
+        integer_size--;
+    }
+    int magnitude = 0;
+    if (digits.size() != integer_size)
+    {
+        magnitude = digits.size() < integer_size ? -1 : 1;
+    }
+    else
+    {
+        for (uint64_t i = integer_size; i > 0 && magnitude == 0; i--)
+        {
+            if (digits[i - 1] != integer.coefficient[i - 1])
+            {
+                magnitude = digits[i - 1] < integer.coefficient[i - 1] ? -1 : 1;
+            }
+        }
+    }
+    return view_negative ? -magnitude : magnitude;
+}
+
+bool operator==(const big_int_view &view, const big_int &integer)
+{
+    return view.compare(integer) == 0;
+}
+#endif
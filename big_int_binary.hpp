@@ -0,0 +1,191 @@
+#pragma once
+/**
+ * @file big_int_binary.hpp
+ * @author Gabrielle Ching-Johnson
+ * @brief Header file for reading and writing big integers in a compact binary format, and memory mapped read only views
+ * @version 0.3
+ * @date Oct 18, 2026
+ */
+
+#include <iostream>
+#include <string>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include "big_int.hpp"
+using namespace std;
+
+/*
+ * Binary format of a big integer, every field is little endian:
+ *
+ *   bytes 0 - 3    the magic characters "BINT"
+ *   bytes 4 - 7    flags, bit 0 is set if the integer is negative
+ *   bytes 8 - 15   the number of coefficients n
+ *   bytes 16 - ... the n coefficients in base 2^32, least significant first
+ *
+ * The coefficients are stored exactly as in memory on a little endian machine, thus writing and reading them is a
+ * single copy, and a big_int_view can use them in place from a memory mapped file.
+ */
+
+// Size in bytes of the header before the coefficients
+constexpr uint64_t big_int_binary_header_size = 16;
+
+/***************************** Exceptions ***************************/
+/**
+ * @brief Exception to be thrown if data is not a big integer in the binary format
+ */
+class invalid_binary_integer : public invalid_argument
+{
+public:
+    invalid_binary_integer() : invalid_argument("The data is not a big integer in the binary format, or it is truncated"){};
+};
+
+/**
+ * @brief Exception to be thrown if a file of a big integer can not be opened, read, written or mapped
+ */
+class big_int_file_error : public runtime_error
+{
+public:
+    big_int_file_error(const string &path) : runtime_error("Could not access the big integer file " + path){};
+};
+
+/************************** Reading and Writing *************************/
+/**
+ * @brief Writes a big integer in the binary format
+ * @param out The stream to write to
+ * @param integer The big_int to write
+ */
+void write_binary(ostream &out, const big_int &integer);
+
+/**
+ * @brief Reads a big integer in the binary format
+ * @details Throws the exception invalid_binary_integer if the data is not in the binary format
+ * @param in The stream to read from
+ * @return The big_int read
+ */
+big_int read_binary(istream &in);
+
+/**
+ * @brief Writes a big integer to a file in the binary format
+ * @details Throws the exception big_int_file_error if the file can not be written
+ * @param path The path of the file, it is replaced if it exists
+ * @param integer The big_int to write
+ */
+void save_binary(const string &path, const big_int &integer);
+
+/**
+ * @brief Reads a big integer from a file in the binary format
+ * @details Throws the exception big_int_file_error if the file can not be read
+ * @param path The path of the file
+ * @return The big_int read
+ */
+big_int load_binary(const string &path);
+
+/************************** Memory Mapped Views *************************/
+// The views use mmap, thus they are only declared on POSIX systems; the rest of the binary format is portable
+#if defined(__unix__) || defined(__APPLE__)
+#define BIG_INT_MAPPED_VIEW
+
+/**
+ * @brief This class maps a file in the binary format into memory and reads its big integer in place, without copying
+ *        the coefficients
+ * @details The pages of the file are only read from the disk when they are used. A view can only be moved, the file
+ *          is unmapped when the view is destroyed. Only supported on POSIX systems with little endian byte order.
+ */
+class big_int_view
+{
+public:
+    /**
+     * @brief Maps a file in the binary format into memory
+     * @details Throws the exception big_int_file_error if the file can not be mapped and invalid_binary_integer if it is
+     *          not in the binary format
+     * @param path The path of the file
+     */
+    explicit big_int_view(const string &path);
+
+    big_int_view(const big_int_view &) = delete;
+    big_int_view &operator=(const big_int_view &) = delete;
+
+    /**
+     * @brief Move constructor, the moved from view is left without a file and the value zero
+     * @param view The view to move from
+     */
+    big_int_view(big_int_view &&view) noexcept;
+
+    /**
+     * @brief Move assignment, unmaps the file of this view first
+     * @param view The view to move from
+     * @return A reference to this view
+     */
+    big_int_view &operator=(big_int_view &&view) noexcept;
+
+    /**
+     * @brief Unmaps the file
+     */
+    ~big_int_view();
+
+    /**
+     * @brief Gets the sign of the big integer
+     * @return The sign of the big integer
+     */
+    sign get_sign() const;
+
+    /**
+     * @brief Gets the coefficient at an index, throws an exception if the index is out of range
+     * @param index The index of the coefficient, 0 is the least significant
+     * @return The coefficient at the index
+     */
+    const uint32_t &at(const uint64_t &index) const;
+
+    /**
+     * @brief Gets the number of coefficients of the big integer, without leading zeros
+     * @return The number of coefficients
+     */
+    uint64_t coefficient_size() const;
+
+    /**
+     * @brief Gets the coefficients in the mapped file
+     * @return The coefficients in base 2^32, least significant first
+     */
+    span<const uint32_t> coefficients() const;
+
+    /**
+     * @brief Copies the big integer into a big_int
+     * @return The big_int with the value of the view
+     */
+    big_int to_big_int() const;
+
+    /**
+     * @brief Compares the big integer with another one, using the coefficients in place
+     * @param integer The big_int to compare with
+     * @return -1 if the view is less than the big_int, 0 if they are equal and 1 if it is greater
+     */
+    int compare(const big_int &integer) const;
+
+    /**
+     * @brief Operator overload for ==, compares the coefficients in place
+     * @param view The view
+     * @param integer The big_int
+     * @return True if the view and the big_int have the same value
+     */
+    friend bool operator==(const big_int_view &view, const big_int &integer);
+
+private:
+    // The start of the mapped file
+    void *mapping = nullptr;
+
+    // The number of bytes mapped
+    uint64_t mapping_size = 0;
+
+    // The coefficients in the mapped file, without leading zeros
+    span<const uint32_t> digits;
+
+    // The sign of the big integer
+    sign integer_sign = sign::POSITIVE;
+
+    /**
+     * @brief Unmaps the file, if any
+     */
+    void unmap();
+};
+#endif
@@ -0,0 +1,238 @@
+/**
+ * @file big_int_combinatorics.cpp
+ * @author Gabrielle Ching-Johnson
+ * @brief C++ code file for products of many big integers, factorials and binomial coefficients
+ * @version 0.3
+ * @date Oct 18, 2026
+ */
+
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+#include "big_int_combinatorics.hpp"
+#include "thread_pool.hpp"
+using namespace std;
+
+/**
+ * @brief Creates a big integer from an unsigned 64 bit integer
+ * @param value The unsigned integer
+ * @return The big_int with the same value
+ */
+static big_int from_unsigned(const uint64_t &value)
+{
+    if (value <= (uint64_t)INT64_MAX)
+    {
+        return big_int((int64_t)value);
+    }
+    return big_int(vector<uint32_t>{(uint32_t)(value >> 32), (uint32_t)(value & (uint64_t)UINT32_MAX)});
+}
+
+/**
+ * @brief Multiplies the factors in [first, last) with a balanced product tree
+ * @param factors The big_ints to multiply
+ * @param sizes sizes[i] is the number of coefficients of the factors before index i
+ * @param first The index of the first factor
+ * @param last The index after the last factor
+ * @return The product of the factors
+ */
+static big_int multiply_tree(const vector<big_int> &factors, const vector<uint64_t> &sizes, const uint64_t &first, const uint64_t &last)
+{
+    if (last - first == 1)
+    {
+        return factors[first];
+    }
+    if (last - first == 2)
+    {
+        return factors[first] * factors[first + 1];
+    }
+
+    uint64_t middle = first + (last - first) / 2;
+    big_int left;
+    big_int right;
+
+    // The halves of a large tree are multiplied in parallel, the product of the halves is parallel by itself
+    if (sizes[last] - sizes[first] >= parallel_multiply_threshold() && big_int_thread_pool().size() > 1)
+    {
+        task_group group(big_int_thread_pool());
+        group.run([&]
+                  { left = multiply_tree(factors, sizes, first, middle); });
+        right = multiply_tree(factors, sizes, middle, last);
+        group.wait();
+    }
+    else
+    {
+        left = multiply_tree(factors, sizes, first, middle);
+        right = multiply_tree(factors, sizes, middle, last);
+    }
+    return left * right;
+}
+
+/**
+ * @brief Multiplies unsigned 64 bit factors with a balanced product tree
+ * @details Consecutive factors are first multiplied together while they fit in 63 bits, which makes the tree smaller
+ * @param factors The factors to multiply
+ * @return The product of the factors
+ */
+static big_int multiply_small(const vector<uint64_t> &factors)
+{
+    vector<big_int> leaves;
+    uint64_t leaf = 1;
+    for (const uint64_t &factor : factors)
+    {
+        if (factor != 0 && leaf > (uint64_t)INT64_MAX / factor)
+        {
+            leaves.push_back(from_unsigned(leaf));
+            leaf = 1;
+        }
+        leaf *= factor;
+    }
+    leaves.push_back(from_unsigned(leaf));
+    return product(leaves);
+}
+
+/**
+ * @brief Finds the primes less than or equal to n with the sieve of Eratosthenes
+ * @param n The largest integer to check
+ * @return The primes in increasing order
+ */
+static vector<uint64_t> primes_up_to(const uint64_t &n)
+{
+    vector<uint64_t> primes;
+    if (n < 2)
+    {
+        return primes;
+    }
+
+    // One bit per integer, every multiple of a prime p from p^2 is crossed out
+    vector<bool> composite(n + 1, false);
+    for (uint64_t i = 2; i <= n; i++)
+    {
+        if (composite[i])
+        {
+            continue;
+        }
+        primes.push_back(i);
+        if (i > n / i)
+        {
+            continue;
+        }
+        for (uint64_t multiple = i * i; multiple <= n; multiple += i)
+        {
+            composite[multiple] = true;
+        }
+    }
+    return primes;
+}
+
+/**
+ * @brief Finds the swing of n, n! / ((n / 2)!)^2
+ * @details The exponent of a prime p in the swing is the number of odd values of floor(n / p^i) for i >= 1, thus
+ *          every prime power of the swing is at most n
+ * @param n The integer to find the swing of
+ * @param primes The primes up to at least n
+ * @return The big_int swing(n)
+ */
+static big_int swing(const uint64_t &n, const vector<uint64_t> &primes)
+{
+    vector<uint64_t> factors;
+    for (const uint64_t &prime : primes)
+    {
+        if (prime > n)
+        {
+            break;
+        }
+
+        uint64_t power = 1;
+        for (uint64_t quotient = n / prime; quotient > 0; quotient /= prime)
+        {
+            if ((quotient & 1) != 0)
+            {
+                power *= prime;
+            }
+        }
+        if (power > 1)
+        {
+            factors.push_back(power);
+        }
+    }
+    return multiply_small(factors);
+}
+
+/**
+ * @brief Finds n! as ((n / 2)!)^2 * swing(n)
+ * @param n The integer to find the factorial of
+ * @param primes The primes up to at least n
+ * @return The big_int n!
+ */
+static big_int prime_swing_factorial(const uint64_t &n, const vector<uint64_t> &primes)
+{
+    // Small factorials fit in 64 bits
+    if (n <= 20)
+    {
+        uint64_t value = 1;
+        for (uint64_t i = 2; i <= n; i++)
+        {
+            value *= i;
+        }
+        return from_unsigned(value);
+    }
+
+    big_int half = prime_swing_factorial(n / 2, primes);
+    big_int square = half * half;
+    return square * swing(n, primes);
+}
+
+/******************************* Products ******************************/
+big_int product(const vector<big_int> &factors)
+{
+    if (factors.empty())
+    {
+        return big_int(1);
+    }
+
+    vector<uint64_t> sizes(factors.size() + 1, 0);
+    for (uint64_t i = 0; i < factors.size(); i++)
+    {
+        sizes[i + 1] = sizes[i] + factors[i].coefficient_size();
+    }
+    return multiply_tree(factors, sizes, 0, factors.size());
+}
+
+big_int factorial(const uint64_t &n)
+{
+    return prime_swing_factorial(n, primes_up_to(n));
+}
+
+big_int binomial(const uint64_t &n, const uint64_t &k)
+{
+    if (k > n)
+    {
+        return big_int();
+    }
+
+    // Legendre's formula gives the exponent of p in n!, k! and (n - k)!, the prime power is at most n (Kummer)
+    uint64_t rest = n - k;
+    vector<uint64_t> factors;
+    for (const uint64_t &prime : primes_up_to(n))
+    {
+        uint64_t power = 1;
+        uint64_t quotient_n = n / prime;
+        uint64_t quotient_k = k / prime;
+        uint64_t quotient_rest = rest / prime;
+        while (quotient_n > 0)
+        {
+            for (uint64_t e = quotient_k + quotient_rest; e < quotient_n; e++)
+            {
+                power *= prime;
+            }
+            quotient_n /= prime;
+            quotient_k /= prime;
+            quotient_rest /= prime;
+        }
+        if (power > 1)
+        {
+            factors.push_back(power);
+        }
+    }
+    return multiply_small(factors);
+}
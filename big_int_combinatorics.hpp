@@ -0,0 +1,66 @@
+#pragma once
+/**
+ * @file big_int_combinatorics.hpp
+ * @author Gabrielle Ching-Johnson
+ * @brief Header file for products of many big integers, factorials and binomial coefficients
+ * @version 0.3
+ * @date Oct 18, 2026
+ */
+
+#include <vector>
+#include <cstdint>
+#include <ranges>
+#include <concepts>
+#include "big_int.hpp"
+using namespace std;
+
+/*
+ * Multiplying many integers from left to right multiplies a growing product by one small factor at a time, which
+ * costs time quadratic in the size of the result. These functions multiply the factors in a balanced product tree
+ * instead: the factors are multiplied in pairs, then the pairs in pairs and so on, thus the last multiplications have
+ * two operands of the same size and use the Karatsuba method. The two halves of a large tree are multiplied in parallel
+ * on the threads set with set_big_int_threads() (see thread_pool.hpp).
+ */
+
+/**
+ * @brief Multiplies big integers with a balanced product tree
+ * @param factors The big_ints to multiply
+ * @return The product of the factors, 1 if there are none
+ */
+big_int product(const vector<big_int> &factors);
+
+/**
+ * @brief Multiplies the values of a range with a balanced product tree
+ * @param factors A range of big_ints or values convertible to a big_int
+ * @return The product of the factors, 1 if there are none
+ */
+template <ranges::input_range R>
+    requires convertible_to<ranges::range_reference_t<R>, big_int> && (!same_as<remove_cvref_t<R>, vector<big_int>>)
+big_int product(R &&factors)
+{
+    vector<big_int> values;
+    for (auto &&factor : factors)
+    {
+        values.push_back(big_int(factor));
+    }
+    return product(values);
+}
+
+/**
+ * @brief Finds n! with the prime swing method
+ * @details n! = ((n / 2)!)^2 * swing(n), where swing(n) is a product of prime powers less than or equal to n that is
+ *          found with a product tree. Uses a sieve of n bits to find the primes.
+ * @param n The integer to find the factorial of
+ * @return The big_int n!
+ */
+big_int factorial(const uint64_t &n);
+
+/**
+ * @brief Finds the binomial coefficient n choose k
+ * @details The exponent of each prime in n! / (k! (n - k)!) is found with Legendre's formula and the prime powers are
+ *          multiplied with a product tree. Uses a sieve of n bits to find the primes.
+ * @param n The number of items
+ * @param k The number of items chosen
+ * @return The big_int n! / (k! (n - k)!), 0 if k > n
+ */
+big_int binomial(const uint64_t &n, const uint64_t &k);
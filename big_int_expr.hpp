@@ -0,0 +1,474 @@
+#pragma once
+/**
+ * @file big_int_expr.hpp
+ * @author Gabrielle Ching-Johnson
+ * @brief Expression templates that defer the evaluation of big_int sums, differences, negations and products until assignment
+ * @version 0.3
+ * @date Oct 18, 2026
+ */
+
+#include <array>
+#include <concepts>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <type_traits>
+#include "big_int.hpp"
+using namespace std;
+
+/*
+ * The +, - and * operators do not compute a big_int right away, instead they build a small tree of nodes that only
+ * refer to their operands. When the tree is assigned to a big_int all added and subtracted big_ints are summed in a
+ * single pass over their coefficients and each product is accumulated directly into the result, thus
+ * a * b + c * d - e only allocates the coefficients of the result.
+ *
+ * A named big_int is referred to, a temporary big_int (ie f() + g(), -5_bi or std::move(x) + y) is moved into the
+ * tree, thus an expression of temporaries can be stored in an auto variable or returned from a function. An expression
+ * that refers to a named big_int must be assigned to a big_int before that big_int goes out of scope (ie a function
+ * returning auto must not return a + b of its parameters a and b, it can return std::move(a) + std::move(b)).
+ *
+ * An expression is not a big_int: the accessors at(), coefficient_size(), to_string() and get_sign() evaluate it first
+ * and it converts to a big_int wherever one is expected, but two expressions of different shapes have different types,
+ * thus c ? a + b : a * b must convert one branch (ie c ? big_int(a + b) : a * b).
+ */
+
+/**
+ * @brief Base class of every node of a deferred big_int expression
+ * @tparam E The type of the node
+ */
+template <class E>
+class big_int_expr
+{
+public:
+    /**
+     * @brief Gets the node this expression represents
+     * @return A reference to the node
+     */
+    constexpr const E &node() const
+    {
+        return static_cast<const E &>(*this);
+    }
+
+    /*
+     * The accessors of big_int evaluate the expression first, so (a + b).get_sign() compiles as it did when the
+     * operators returned a big_int. They return values instead of references into the evaluated big_int.
+     */
+
+    /**
+     * @brief Evaluates the expression and gets a coefficient of the result, throws an exception if the index is out of range
+     * @param index The index of the coefficient, 0 is the least significant
+     * @return The coefficient at the index
+     */
+    constexpr uint32_t at(const uint64_t &index) const
+    {
+        return big_int(*this).at(index);
+    }
+
+    /**
+     * @brief Evaluates the expression and gets the number of coefficients of the result
+     * @return The number of coefficients
+     */
+    constexpr uint64_t coefficient_size() const
+    {
+        return big_int(*this).coefficient_size();
+    }
+
+    /**
+     * @brief Evaluates the expression and converts the result to a string in a radix from 2 to 36 (see big_int::to_string)
+     * @param radix The radix of the digits
+     * @return A string containing the sign and digits of the result
+     */
+    string to_string(const uint32_t &radix = 10) const
+    {
+        return big_int(*this).to_string(radix);
+    }
+
+    /**
+     * @brief Evaluates the expression and gets the sign of the result
+     * @return The sign of the result, zero is positive
+     */
+    constexpr sign get_sign() const
+    {
+        return big_int(*this).get_sign();
+    }
+};
+
+/**
+ * @brief Leaf of an expression that refers to an existing big_int
+ */
+class big_int_ref : public big_int_expr<big_int_ref>
+{
+public:
+    // Number of big_ints this node adds to the single pass sum
+    static constexpr uint64_t term_count = 1;
+
+    constexpr explicit big_int_ref(const big_int &integer) : value(integer){};
+
+    /**
+     * @brief Adds the big_ints of this node to the terms of the single pass sum
+     * @param terms The array of terms to fill
+     * @param count The number of terms filled so far
+     * @param subtract True if the node is subtracted from the expression
+     */
+    constexpr void collect_terms(big_int_term *terms, uint64_t &count, const bool &subtract) const
+    {
+        terms[count++] = {&value, subtract};
+    }
+
+    /**
+     * @brief Accumulates the products of this node into the result (a leaf has none)
+     */
+    constexpr void accumulate_products(big_int &, const bool &) const {}
+
+    // The big_int referred to
+    const big_int &value;
+};
+
+/**
+ * @brief Leaf of an expression that holds its own big_int, used for temporary big_ints and for operands that are not
+ *        big_ints (ie x + 1.0)
+ */
+class big_int_value : public big_int_expr<big_int_value>
+{
+public:
+    static constexpr uint64_t term_count = 1;
+
+    constexpr explicit big_int_value(big_int &&integer) : value(std::move(integer)){};
+
+    constexpr void collect_terms(big_int_term *terms, uint64_t &count, const bool &subtract) const
+    {
+        terms[count++] = {&value, subtract};
+    }
+
+    constexpr void accumulate_products(big_int &, const bool &) const {}
+
+    // The big_int held by the leaf
+    big_int value;
+};
+
+/**
+ * @brief Gets the big_int value of an operand of a product
+ * @details Leaves are used in place, any other expression is evaluated into a temporary big_int
+ * @param operand The operand of the product
+ * @return The big_int value of the operand
+ */
+template <class E>
+constexpr decltype(auto) operand_value(const E &operand)
+{
+    if constexpr (same_as<E, big_int_ref> || same_as<E, big_int_value>)
+        return (operand.value);
+    else
+        return big_int(operand);
+}
+
+/**
+ * @brief Node of an expression that adds or subtracts two expressions
+ * @tparam L The left expression
+ * @tparam R The right expression
+ * @tparam Subtract True if the right expression is subtracted from the left
+ */
+template <class L, class R, bool Subtract>
+class big_int_sum : public big_int_expr<big_int_sum<L, R, Subtract>>
+{
+public:
+    static constexpr uint64_t term_count = L::term_count + R::term_count;
+
+    constexpr big_int_sum(L left_operand, R right_operand) : left(std::move(left_operand)), right(std::move(right_operand)){};
+
+    constexpr void collect_terms(big_int_term *terms, uint64_t &count, const bool &subtract) const
+    {
+        left.collect_terms(terms, count, subtract);
+        right.collect_terms(terms, count, subtract != Subtract);
+    }
+
+    constexpr void accumulate_products(big_int &result, const bool &subtract) const
+    {
+        left.accumulate_products(result, subtract);
+        right.accumulate_products(result, subtract != Subtract);
+    }
+
+    L left;
+    R right;
+};
+
+/**
+ * @brief Node of an expression that negates an expression
+ * @tparam E The expression to negate
+ */
+template <class E>
+class big_int_negation : public big_int_expr<big_int_negation<E>>
+{
+public:
+    static constexpr uint64_t term_count = E::term_count;
+
+    constexpr explicit big_int_negation(E operand_expression) : operand(std::move(operand_expression)){};
+
+    constexpr void collect_terms(big_int_term *terms, uint64_t &count, const bool &subtract) const
+    {
+        operand.collect_terms(terms, count, !subtract);
+    }
+
+    constexpr void accumulate_products(big_int &result, const bool &subtract) const
+    {
+        operand.accumulate_products(result, !subtract);
+    }
+
+    E operand;
+};
+
+/**
+ * @brief Node of an expression that multiplies two expressions
+ * @details The product is never stored on its own, it is accumulated into the coefficients of the result
+ * @tparam L The left expression
+ * @tparam R The right expression
+ */
+template <class L, class R>
+class big_int_product : public big_int_expr<big_int_product<L, R>>
+{
+public:
+    // A product is not part of the single pass sum
+    static constexpr uint64_t term_count = 0;
+
+    constexpr big_int_product(L left_operand, R right_operand) : left(std::move(left_operand)), right(std::move(right_operand)){};
+
+    constexpr void collect_terms(big_int_term *, uint64_t &, const bool &) const {}
+
+    constexpr void accumulate_products(big_int &result, const bool &subtract) const
+    {
+        if (is_constant_evaluated())
+            constant_addmul(result, operand_value(left), operand_value(right), subtract);
+        else if (subtract)
+            submul(result, operand_value(left), operand_value(right));
+        else
+            addmul(result, operand_value(left), operand_value(right));
+    }
+
+    L left;
+    R right;
+};
+
+/**
+ * @brief True if the expression is a single product (ie a * b)
+ */
+template <class E>
+constexpr bool is_big_int_product = false;
+
+template <class L, class R>
+constexpr bool is_big_int_product<big_int_product<L, R>> = true;
+
+/**
+ * @brief A big_int or a node of a big_int expression
+ */
+template <class T>
+concept big_int_operand = same_as<T, big_int> || derived_from<T, big_int_expr<T>>;
+
+/**
+ * @brief An integer of a built in type that is not a bool or a character, its operators with a big_int are the ones of
+ *        big_int_native.hpp
+ */
+template <class T>
+concept big_int_native_integer = integral<T> && !same_as<T, bool> && !same_as<T, char> && !same_as<T, char8_t> &&
+                                 !same_as<T, char16_t> && !same_as<T, char32_t> && !same_as<T, wchar_t>;
+
+/**
+ * @brief Two operands of a binary operator, at least one of them must be a big_int (or expression) and the other one
+ *        must be convertible to a big_int (ie x + 1.0 is still allowed); a big_int and a built in integer use the
+ *        operators of big_int_native.hpp instead
+ */
+template <class L, class R>
+concept big_int_operands = (big_int_operand<L> || big_int_operand<R>) &&
+                           (big_int_operand<L> || convertible_to<const L &, big_int>) &&
+                           (big_int_operand<R> || convertible_to<const R &, big_int>) &&
+                           !(same_as<L, big_int> && big_int_native_integer<R>) &&
+                           !(big_int_native_integer<L> && same_as<R, big_int>);
+
+/**
+ * @brief Turns an operand into a node of an expression
+ * @details A big_int is referred to and an expression is copied, use the overloads for temporaries to move them
+ * @param operand A big_int, expression or value convertible to a big_int
+ * @return The node representing the operand
+ */
+template <class T>
+constexpr auto as_expression(const T &operand)
+{
+    if constexpr (same_as<T, big_int>)
+        return big_int_ref(operand);
+    else if constexpr (big_int_operand<T>)
+        return operand;
+    else
+        return big_int_value(big_int(operand));
+}
+
+/**
+ * @brief Turns a temporary big_int into a node of an expression that holds it, so the node can not outlive it
+ * @param operand The temporary big_int, moved into the node
+ * @return The node holding the big_int
+ */
+constexpr big_int_value as_expression(big_int &&operand)
+{
+    return big_int_value(std::move(operand));
+}
+
+/**
+ * @brief Turns a temporary expression into a node of an expression by moving it, so the big_ints it holds are not copied
+ * @param operand The temporary expression
+ * @return The node representing the expression
+ */
+template <class T>
+    requires derived_from<T, big_int_expr<T>>
+constexpr T as_expression(T &&operand)
+{
+    return std::move(operand);
+}
+
+/**
+ * @brief The node type representing an operand, a reference type T is a named operand and any other type a temporary
+ */
+template <class T>
+using big_int_expression_t = decltype(as_expression(declval<T>()));
+
+/************************** Operator Overloads *************************/
+/**
+ * @brief Operator overload for + that defers the addition until the expression is assigned to a big_int
+ * @param int_a The first big_int (or expression) to be added
+ * @param int_b The second big_int (or expression) to be added
+ * @return An expression representing the sum
+ */
+template <class L, class R>
+    requires big_int_operands<remove_cvref_t<L>, remove_cvref_t<R>>
+constexpr auto operator+(L &&int_a, R &&int_b)
+{
+    return big_int_sum<big_int_expression_t<L>, big_int_expression_t<R>, false>(as_expression(std::forward<L>(int_a)), as_expression(std::forward<R>(int_b)));
+}
+
+/**
+ * @brief Operator overload for - that defers the subtraction until the expression is assigned to a big_int
+ * @param int_a The big_int (or expression) to be subtracted from
+ * @param int_b The big_int (or expression) to subtract from the first
+ * @return An expression representing the difference
+ */
+template <class L, class R>
+    requires big_int_operands<remove_cvref_t<L>, remove_cvref_t<R>>
+constexpr auto operator-(L &&int_a, R &&int_b)
+{
+    return big_int_sum<big_int_expression_t<L>, big_int_expression_t<R>, true>(as_expression(std::forward<L>(int_a)), as_expression(std::forward<R>(int_b)));
+}
+
+/**
+ * @brief Negation operator overload that defers the negation until the expression is assigned to a big_int
+ * @param int_a The big_int (or expression) to be negated
+ * @return An expression representing the negation
+ */
+template <class T>
+    requires big_int_operand<remove_cvref_t<T>>
+constexpr auto operator-(T &&int_a)
+{
+    return big_int_negation<big_int_expression_t<T>>(as_expression(std::forward<T>(int_a)));
+}
+
+/**
+ * @brief Operator overload for * that defers the multiplication until the expression is assigned to a big_int
+ * @param int_a The first big_int (or expression) to be multiplied
+ * @param int_b The second big_int (or expression) to be multiplied
+ * @return An expression representing the product
+ */
+template <class L, class R>
+    requires big_int_operands<remove_cvref_t<L>, remove_cvref_t<R>>
+constexpr auto operator*(L &&int_a, R &&int_b)
+{
+    return big_int_product<big_int_expression_t<L>, big_int_expression_t<R>>(as_expression(std::forward<L>(int_a)), as_expression(std::forward<R>(int_b)));
+}
+
+// Declared at namespace scope so that they are also found when called with an expression (ie print_base10(a * b))
+big_int operator/(const big_int &dividend, const big_int &divisor);
+string print_base10(const big_int &integer);
+
+/************************** Evaluation of Expressions *************************/
+template <class E>
+constexpr big_int::big_int(const big_int_expr<E> &expression)
+{
+    const E &node = expression.node();
+
+    // Sum all added and subtracted big_ints in one pass, then accumulate each product into the result
+    array<big_int_term, E::term_count> terms{};
+    uint64_t count = 0;
+    node.collect_terms(terms.data(), count, false);
+    if (is_constant_evaluated())
+    {
+        // The compiler adds the terms one at a time with constexpr code
+        coefficient.assign(1, 0);
+        for (uint64_t i = 0; i < count; i++)
+        {
+            constant_add(*this, *terms[i].value, terms[i].subtract);
+        }
+    }
+    else
+    {
+        linear_combination(*this, terms.data(), count);
+    }
+    node.accumulate_products(*this, false);
+}
+
+template <class E>
+constexpr big_int &big_int::operator=(const big_int_expr<E> &expression)
+{
+    // Evaluate into a new big_int first since the expression may refer to this big_int
+    *this = big_int(expression);
+    return *this;
+}
+
+template <class E>
+constexpr big_int &big_int::operator+=(const big_int_expr<E> &expression)
+{
+    const E &node = expression.node();
+    if constexpr (is_big_int_product<E>)
+    {
+        if (is_constant_evaluated())
+        {
+            constant_addmul(*this, operand_value(node.left), operand_value(node.right), false);
+        }
+        else
+        {
+            addmul(*this, operand_value(node.left), operand_value(node.right));
+        }
+    }
+    else
+    {
+        *this = *this + node;
+    }
+    return *this;
+}
+
+template <class E>
+constexpr big_int &big_int::operator-=(const big_int_expr<E> &expression)
+{
+    const E &node = expression.node();
+    if constexpr (is_big_int_product<E>)
+    {
+        if (is_constant_evaluated())
+        {
+            constant_addmul(*this, operand_value(node.left), operand_value(node.right), true);
+        }
+        else
+        {
+            submul(*this, operand_value(node.left), operand_value(node.right));
+        }
+    }
+    else
+    {
+        *this = *this - node;
+    }
+    return *this;
+}
+
+constexpr big_int &big_int::operator+=(const big_int &big_integer)
+{
+    *this = *this + big_integer;
+    return *this;
+}
+
+constexpr big_int &big_int::operator-=(const big_int &big_integer)
+{
+    *this = *this - big_integer;
+    return *this;
+}
@@ -0,0 +1,174 @@
+/**
+ * @file big_int_intern.cpp
+ * @author Gabrielle Ching-Johnson
+ * @brief C++ code file for the table that keeps a single copy of equal big integers (hash consing)
+ * @version 0.3
+ * @date Oct 18, 2026
+ */
+
+#include <memory>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <shared_mutex>
+#include <utility>
+#include "big_int_intern.hpp"
+using namespace std;
+
+/******************************* Handles ******************************/
+interned_big_int::interned_big_int() : interned_big_int(big_int_interned().intern(big_int())){};
+
+interned_big_int::interned_big_int(shared_ptr<const big_int> interned) : integer(std::move(interned)){};
+
+const big_int &interned_big_int::value() const
+{
+    return *integer;
+}
+
+interned_big_int::operator const big_int &() const
+{
+    return *integer;
+}
+
+uint64_t interned_big_int::use_count() const
+{
+    return (uint64_t)integer.use_count();
+}
+
+bool operator==(const interned_big_int &int_a, const interned_big_int &int_b)
+{
+    return int_a.integer == int_b.integer;
+}
+
+size_t std::hash<interned_big_int>::operator()(const interned_big_int &integer) const noexcept
+{
+    return hash<const big_int *>{}(&integer.value());
+}
+
+/******************************* Entries of the Table ******************************/
+size_t big_int_intern_table::entry_hash::operator()(const entry &value) const noexcept
+{
+    return value.hash;
+}
+
+size_t big_int_intern_table::entry_hash::operator()(const lookup &value) const noexcept
+{
+    return value.hash;
+}
+
+bool big_int_intern_table::entry_equal::operator()(const entry &value_a, const entry &value_b) const
+{
+    return value_a.hash == value_b.hash && *value_a.integer == *value_b.integer;
+}
+
+bool big_int_intern_table::entry_equal::operator()(const entry &value_a, const lookup &value_b) const
+{
+    return value_a.hash == value_b.hash && *value_a.integer == *value_b.integer;
+}
+
+bool big_int_intern_table::entry_equal::operator()(const lookup &value_a, const entry &value_b) const
+{
+    return value_a.hash == value_b.hash && *value_a.integer == *value_b.integer;
+}
+
+/******************************* Intern Table ******************************/
+big_int_intern_table::big_int_intern_table(const uint64_t &shards) : shard_count(shards == 0 ? 1 : shards), shards(make_unique<shard[]>(shard_count)){};
+
+interned_big_int big_int_intern_table::intern(const big_int &integer)
+{
+    return intern_with(integer, [&integer]
+                       { return make_shared<const big_int>(integer); });
+}
+
+interned_big_int big_int_intern_table::intern(big_int &&integer)
+{
+    return intern_with(integer, [&integer]
+                       { return make_shared<const big_int>(std::move(integer)); });
+}
+
+big_int_intern_table::shard &big_int_intern_table::shard_of(const lookup &key) const
+{
+    // The high bits of the hash choose the shard, the set uses the low bits for its buckets
+    return shards[(key.hash >> 32) % shard_count];
+}
+
+interned_big_int big_int_intern_table::intern_with(const big_int &integer, const function<shared_ptr<const big_int>()> &make)
+{
+    lookup key{&integer, hash<big_int>{}(integer)};
+    shard &part = shard_of(key);
+
+    // Most values are already interned, they are found under the shared lock
+    {
+        shared_lock<shared_mutex> reading(part.lock);
+        auto found = part.values.find(key);
+        if (found != part.values.end())
+        {
+            return interned_big_int(found->integer);
+        }
+    }
+
+    // Another thread may have stored the value between the two locks, then its copy is the one kept
+    unique_lock<shared_mutex> writing(part.lock);
+    auto found = part.values.find(key);
+    if (found != part.values.end())
+    {
+        return interned_big_int(found->integer);
+    }
+    return interned_big_int(part.values.insert(entry{make(), key.hash}).first->integer);
+}
+
+bool big_int_intern_table::find(const big_int &integer, interned_big_int &found) const
+{
+    lookup key{&integer, hash<big_int>{}(integer)};
+    const shard &part = shard_of(key);
+    shared_lock<shared_mutex> reading(part.lock);
+    auto value = part.values.find(key);
+    if (value == part.values.end())
+    {
+        return false;
+    }
+    found = interned_big_int(value->integer);
+    return true;
+}
+
+uint64_t big_int_intern_table::collect()
+{
+    // A value only held by the table has no handle, a handle can only be copied from another one thus none can
+    // appear while the shard is locked
+    uint64_t removed = 0;
+    for (uint64_t i = 0; i < shard_count; i++)
+    {
+        unique_lock<shared_mutex> writing(shards[i].lock);
+        removed += erase_if(shards[i].values, [](const entry &value)
+                            { return value.integer.use_count() == 1; });
+    }
+    return removed;
+}
+
+uint64_t big_int_intern_table::size() const
+{
+    uint64_t total = 0;
+    for (uint64_t i = 0; i < shard_count; i++)
+    {
+        shared_lock<shared_mutex> reading(shards[i].lock);
+        total += shards[i].values.size();
+    }
+    return total;
+}
+
+/******************************* Shared Table ******************************/
+big_int_intern_table &big_int_interned()
+{
+    static big_int_intern_table table;
+    return table;
+}
+
+interned_big_int intern(const big_int &integer)
+{
+    return big_int_interned().intern(integer);
+}
+
+interned_big_int intern(big_int &&integer)
+{
+    return big_int_interned().intern(std::move(integer));
+}
@@ -0,0 +1,236 @@
+#pragma once
+/**
+ * @file big_int_intern.hpp
+ * @author Gabrielle Ching-Johnson
+ * @brief Header file for a table that keeps a single copy of equal big integers (hash consing) and hands out handles to it
+ * @version 0.3
+ * @date Oct 18, 2026
+ */
+
+#include <memory>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_set>
+#include "big_int.hpp"
+using namespace std;
+
+/*
+ * Interning a big integer looks it up in the table and returns a handle to the copy already there, or stores it if it
+ * is new, thus every handle of equal values refers to the same coefficients (ie moduli, powers and cached results are
+ * stored once however often they are computed) and two handles of the same table are equal exactly when they point to
+ * the same big_int, which takes O(1) time whatever the size of the integers. The values are never changed once
+ * interned, a handle is a reference counted pointer to a constant big_int.
+ *
+ * The table is split in shards chosen by the hash of the value, each with a reader writer lock: looking up a value that
+ * is already interned only takes the shared lock of its shard, so many threads can intern at the same time, and only
+ * storing a new value takes the exclusive lock. The table keeps its values until collect() removes those no handle
+ * refers to anymore.
+ */
+
+class big_int_intern_table;
+
+/**
+ * @brief This class is a handle to a big integer stored in a big_int_intern_table
+ */
+class interned_big_int
+{
+    friend class big_int_intern_table;
+
+public:
+    /**
+     * @brief Initialize a handle to the value 0 of the shared table (see big_int_interned())
+     */
+    interned_big_int();
+
+    /**
+     * @brief Gets the big integer
+     * @return A constant reference to the interned big_int, valid while a handle refers to it
+     */
+    const big_int &value() const;
+
+    /**
+     * @brief Implicit conversion so an interned_big_int can be passed to any function that takes a big_int
+     * @return A constant reference to the interned big_int
+     */
+    operator const big_int &() const;
+
+    /**
+     * @brief Gets the number of handles to the big integer, including the one of its table
+     * @return The number of handles
+     */
+    uint64_t use_count() const;
+
+    /**
+     * @brief Operator overload for ==, compares the pointers only
+     * @details Handles of the same table are equal exactly when their values are equal, handles of different tables
+     *          are equal only if they are copies of each other (compare value() instead)
+     * @param int_a The first handle to compare
+     * @param int_b The second handle to compare
+     * @return A boolean value stating if both handles refer to the same big_int
+     */
+    friend bool operator==(const interned_big_int &int_a, const interned_big_int &int_b);
+
+private:
+    // The big integer, shared with the table and every other handle of an equal value
+    shared_ptr<const big_int> integer;
+
+    /**
+     * @brief Initialize a handle to a big integer of a table
+     * @param interned The big_int stored in the table
+     */
+    explicit interned_big_int(shared_ptr<const big_int> interned);
+};
+
+/**
+ * @brief Hash of a handle to an interned big integer, it hashes the pointer thus it takes O(1) time
+ */
+template <>
+struct std::hash<interned_big_int>
+{
+    /**
+     * @brief Hashes a handle
+     * @param integer The handle to hash
+     * @return The hash of the address of the interned big_int
+     */
+    size_t operator()(const interned_big_int &integer) const noexcept;
+};
+
+/**
+ * @brief This class stores a single copy of equal big integers, it can be used by many threads at the same time
+ */
+class big_int_intern_table
+{
+public:
+    /**
+     * @brief Initialize an empty table
+     * @param shards The number of parts of the table with their own lock, more shards let more threads store new
+     *        values at the same time
+     */
+    explicit big_int_intern_table(const uint64_t &shards = 16);
+
+    big_int_intern_table(const big_int_intern_table &) = delete;
+    big_int_intern_table &operator=(const big_int_intern_table &) = delete;
+
+    /**
+     * @brief Gets the handle to a big integer, storing a copy of it if no equal value is interned
+     * @param integer The big_int to intern, it must be normalized as every result of the big_int operations
+     * @return The handle to the interned big_int equal to integer
+     */
+    interned_big_int intern(const big_int &integer);
+
+    /**
+     * @brief Gets the handle to a big integer, storing it without copying its coefficients if no equal value is interned
+     * @param integer The big_int to intern, it must be normalized as every result of the big_int operations
+     * @return The handle to the interned big_int equal to integer
+     */
+    interned_big_int intern(big_int &&integer);
+
+    /**
+     * @brief Gets the handle to a big integer if an equal value is interned, without storing it otherwise
+     * @param integer The big_int to look up
+     * @param found Set to the handle of the interned big_int if there is one
+     * @return True if an equal value is interned
+     */
+    bool find(const big_int &integer, interned_big_int &found) const;
+
+    /**
+     * @brief Removes the big integers that no handle refers to anymore
+     * @return The number of big integers removed
+     */
+    uint64_t collect();
+
+    /**
+     * @brief Gets the number of interned big integers
+     * @return The number of big integers in the table
+     */
+    uint64_t size() const;
+
+private:
+    /**
+     * @brief An interned big integer with its hash, so the hash is found once and never again when the set grows
+     */
+    struct entry
+    {
+        shared_ptr<const big_int> integer;
+        size_t hash;
+    };
+
+    /**
+     * @brief A big integer being looked up with its hash, it is not copied unless it is stored
+     */
+    struct lookup
+    {
+        const big_int *integer;
+        size_t hash;
+    };
+
+    /**
+     * @brief Hash of the entries that can also hash a lookup, it gives the hash already found
+     */
+    struct entry_hash
+    {
+        using is_transparent = void;
+        size_t operator()(const entry &value) const noexcept;
+        size_t operator()(const lookup &value) const noexcept;
+    };
+
+    /**
+     * @brief Equality of the entries by value that can also compare an entry with a lookup, the hashes are compared first
+     */
+    struct entry_equal
+    {
+        using is_transparent = void;
+        bool operator()(const entry &value_a, const entry &value_b) const;
+        bool operator()(const entry &value_a, const lookup &value_b) const;
+        bool operator()(const lookup &value_a, const entry &value_b) const;
+    };
+
+    /**
+     * @brief A part of the table with its own lock, aligned so the locks of different shards are not in the same cache line
+     */
+    struct alignas(64) shard
+    {
+        mutable shared_mutex lock;
+        unordered_set<entry, entry_hash, entry_equal> values;
+    };
+
+    uint64_t shard_count;
+    unique_ptr<shard[]> shards;
+
+    /**
+     * @brief Gets the shard of a big integer
+     * @param key The big_int being looked up with its hash
+     * @return The shard the big_int is stored in
+     */
+    shard &shard_of(const lookup &key) const;
+
+    /**
+     * @brief Gets the handle to a big integer, storing the one made by a function if no equal value is interned
+     * @param integer The big_int to intern
+     * @param make Makes the big_int to store, called only if integer is not interned
+     * @return The handle to the interned big_int equal to integer
+     */
+    interned_big_int intern_with(const big_int &integer, const function<shared_ptr<const big_int>()> &make);
+};
+
+/**
+ * @brief Gets the intern table shared by the program
+ * @return A reference to the shared table
+ */
+big_int_intern_table &big_int_interned();
+
+/**
+ * @brief Interns a big integer in the shared table (see big_int_interned())
+ * @param integer The big_int to intern
+ * @return The handle to the interned big_int equal to integer
+ */
+interned_big_int intern(const big_int &integer);
+
+/**
+ * @brief Interns a big integer in the shared table without copying its coefficients if it is new
+ * @param integer The big_int to intern
+ * @return The handle to the interned big_int equal to integer
+ */
+interned_big_int intern(big_int &&integer);
@@ -0,0 +1,141 @@
+#pragma once
+/**
+ * @file big_int_literal.hpp
+ * @author Gabrielle Ching-Johnson
+ * @brief User defined literal _bi that creates big integers from integer literals of any length at compile time
+ * @version 0.3
+ * @date Oct 18, 2026
+ */
+
+#include <array>
+#include <vector>
+#include <cstdint>
+#include "big_int.hpp"
+using namespace std;
+
+/*
+ * 123456789012345678901234567890_bi is a big_int. The digits of the literal are converted to base 2^32 coefficients
+ * by the compiler, so no decimal conversion happens at runtime. Decimal, hexadecimal (0x), binary (0b) and octal
+ * (leading 0) literals and digit separators (') are allowed, a negative literal is the negation of a literal
+ * (ie -5_bi). In C++20 memory allocated in a constant expression can not be kept until runtime, thus a big_int
+ * variable can only be constexpr if it is used inside a constant expression; otherwise the coefficients computed
+ * by the compiler are copied into the big_int once at runtime.
+ */
+
+/**
+ * @brief Finds the value of a digit of an integer literal
+ * @param digit The character of the digit
+ * @param radix The base of the literal
+ * @return The value of the digit
+ */
+consteval uint32_t big_int_literal_digit(const char &digit, const uint32_t &radix)
+{
+    uint32_t value = radix;
+    if (digit >= '0' && digit <= '9')
+        value = (uint32_t)(digit - '0');
+    else if (digit >= 'a' && digit <= 'f')
+        value = (uint32_t)(digit - 'a' + 10);
+    else if (digit >= 'A' && digit <= 'F')
+        value = (uint32_t)(digit - 'A' + 10);
+
+    if (value >= radix)
+    {
+        throw invalid_string_integer();
+    }
+    return value;
+}
+
+/**
+ * @brief Converts the characters of an integer literal to base 2^32 coefficients
+ * @details A literal of n characters has at most 4n bits, thus fits in n / 8 + 1 coefficients
+ * @tparam Digits The characters of the literal
+ * @return The coefficients from least significant to most significant, padded with zeros
+ */
+template <char... Digits>
+consteval array<uint32_t, sizeof...(Digits) / 8 + 1> big_int_literal_parse()
+{
+    constexpr array<char, sizeof...(Digits)> digits{Digits...};
+    array<uint32_t, sizeof...(Digits) / 8 + 1> coefficients{};
+
+    // Find the base from the prefix of the literal
+    uint64_t first = 0;
+    uint32_t radix = 10;
+    if (digits.size() > 1 && digits[0] == '0')
+    {
+        if (digits[1] == 'x' || digits[1] == 'X')
+        {
+            radix = 16;
+            first = 2;
+        }
+        else if (digits[1] == 'b' || digits[1] == 'B')
+        {
+            radix = 2;
+            first = 2;
+        }
+        else
+        {
+            radix = 8;
+            first = 1;
+        }
+    }
+
+    // Horner's method, coefficients = coefficients * radix + digit
+    for (uint64_t i = first; i < digits.size(); i++)
+    {
+        if (digits[i] == '\'')
+        {
+            continue;
+        }
+        uint64_t carry = big_int_literal_digit(digits[i], radix);
+        for (uint32_t &coefficient : coefficients)
+        {
+            uint64_t temp = (uint64_t)coefficient * radix + carry;
+            coefficient = (uint32_t)(temp & (uint64_t)UINT32_MAX);
+            carry = temp >> 32;
+        }
+    }
+    return coefficients;
+}
+
+/**
+ * @brief The number of coefficients of the normalized big_int of a literal (at least 1)
+ */
+template <char... Digits>
+inline constexpr uint64_t big_int_literal_size = []
+{
+    array<uint32_t, sizeof...(Digits) / 8 + 1> coefficients = big_int_literal_parse<Digits...>();
+    uint64_t size = coefficients.size();
+    while (size > 1 && coefficients[size - 1] == 0)
+    {
+        size--;
+    }
+    return size;
+}();
+
+/**
+ * @brief The coefficients of the big_int of a literal from most significant to least significant, as taken by the
+ *        vector constructor of big_int
+ */
+template <char... Digits>
+inline constexpr array<uint32_t, big_int_literal_size<Digits...>> big_int_literal_coefficients = []
+{
+    array<uint32_t, sizeof...(Digits) / 8 + 1> coefficients = big_int_literal_parse<Digits...>();
+    array<uint32_t, big_int_literal_size<Digits...>> result{};
+    for (uint64_t i = 0; i < result.size(); i++)
+    {
+        result[i] = coefficients[result.size() - 1 - i];
+    }
+    return result;
+}();
+
+/**
+ * @brief User defined literal that creates a big_int from an integer literal (ie 18446744073709551616_bi)
+ * @tparam Digits The characters of the literal
+ * @return The big_int with the value of the literal
+ */
+template <char... Digits>
+constexpr big_int operator""_bi()
+{
+    const array<uint32_t, big_int_literal_size<Digits...>> &coefficients = big_int_literal_coefficients<Digits...>;
+    return big_int(vector<uint32_t>(coefficients.begin(), coefficients.end()));
+}
@@ -0,0 +1,580 @@
+#pragma once
+/**
+ * @file big_int_native.hpp
+ * @author Gabrielle Ching-Johnson
+ * @brief Operators between big integers and integers of the built in types (ie x + 1, x * 10, x % 7), included by
+ *        big_int.hpp
+ * @version 0.3
+ * @date Oct 18, 2026
+ */
+
+#include <vector>
+#include <cstdint>
+#include <concepts>
+#include <compare>
+#include "big_int.hpp"
+using namespace std;
+
+/*
+ * An operand of a built in integer type (int, long, uint64_t, ...) is not converted to a big_int: +, -, * and the
+ * comparisons work on its 64 bit magnitude directly with the coefficients of the big integer, thus the result is the
+ * only memory allocated (x + 1 allocates once instead of three times), and the compound assignments (x += 1, x *= 10,
+ * x /= 3, x %= 7) allocate nothing unless the big integer grows past its capacity. Division and remainder by an
+ * integer of 32 bits use a single pass over the coefficients; larger divisors use the division of big integers.
+ *
+ * These operators are more specialized than the ones of the expressions (big_int_expr.hpp), thus they are chosen for a
+ * big_int and an integer; an expression and an integer (ie a * b + 1) still converts the integer to a big_int.
+ */
+
+/**
+ * @brief This class has the kernels of the operations between a big integer and a 64 bit magnitude with a sign
+ */
+class big_int_native
+{
+public:
+    /**
+     * @brief Gets the magnitude of an integer
+     * @param integer The integer
+     * @return The absolute value of the integer (ie 2^63 for INT64_MIN)
+     */
+    template <big_int_native_integer T>
+    static constexpr uint64_t magnitude(const T &integer);
+
+    /**
+     * @brief Checks if an integer is negative
+     * @param integer The integer
+     * @return True if the integer is less than zero
+     */
+    template <big_int_native_integer T>
+    static constexpr bool negative(const T &integer);
+
+    /**
+     * @brief Copies a big integer with room for more coefficients, so the copy can grow without allocating again
+     * @param integer The big_int to copy
+     * @param extra The number of coefficients the copy can grow by
+     * @return The copy
+     */
+    static constexpr big_int copy(const big_int &integer, const uint64_t &extra);
+
+    /**
+     * @brief Adds an integer to a big integer (integer += value)
+     * @param integer The big_int to add to
+     * @param value_magnitude The magnitude of the value to add
+     * @param value_negative True if the value is negative
+     */
+    static constexpr void add(big_int &integer, const uint64_t &value_magnitude, const bool &value_negative);
+
+    /**
+     * @brief Multiplies a big integer by an integer (integer *= value)
+     * @param integer The big_int to multiply
+     * @param value_magnitude The magnitude of the value to multiply by
+     * @param value_negative True if the value is negative
+     */
+    static constexpr void multiply(big_int &integer, const uint64_t &value_magnitude, const bool &value_negative);
+
+    /**
+     * @brief Divides a big integer by an integer, the quotient is rounded towards zero (integer /= value)
+     * @details Throws the exception division_by_zero if the value is zero
+     * @param integer The big_int to divide
+     * @param value_magnitude The magnitude of the value to divide by
+     * @param value_negative True if the value is negative
+     */
+    static void divide(big_int &integer, const uint64_t &value_magnitude, const bool &value_negative);
+
+    /**
+     * @brief Finds the remainder of a big integer divided by an integer, it has the sign of the big integer as the
+     *        remainder of the built in types (integer %= value)
+     * @details Throws the exception division_by_zero if the value is zero
+     * @param integer The big_int to divide, set to the remainder
+     * @param value_magnitude The magnitude of the value to divide by, the sign of the value does not matter
+     */
+    static void remainder(big_int &integer, const uint64_t &value_magnitude);
+
+    /**
+     * @brief Finds the remainder of a big integer divided by an integer without copying the big integer, it has the
+     *        sign of the big integer as the remainder of the built in types (dividend % value)
+     * @details Throws the exception division_by_zero if the value is zero
+     * @param dividend The big_int to divide
+     * @param value_magnitude The magnitude of the value to divide by, the sign of the value does not matter
+     * @return The remainder
+     */
+    static big_int remainder_of(const big_int &dividend, const uint64_t &value_magnitude);
+
+    /**
+     * @brief Compares a big integer with an integer
+     * @param integer The big_int
+     * @param value_magnitude The magnitude of the integer
+     * @param value_negative True if the integer is negative
+     * @return -1 if the big_int is less than the integer, 0 if they are equal and 1 if it is greater
+     */
+    static constexpr int compare(const big_int &integer, const uint64_t &value_magnitude, const bool &value_negative);
+
+private:
+    /**
+     * @brief Compares the magnitude of a big integer with a 64 bit magnitude
+     * @param digits The coefficients of the big integer, they can have leading zeros
+     * @param value_magnitude The magnitude to compare with
+     * @return -1 if the magnitude of the big integer is less, 0 if they are equal and 1 if it is greater
+     */
+    static constexpr int compare_magnitude(const vector<uint32_t> &digits, const uint64_t &value_magnitude);
+};
+
+/************************** Kernels *************************/
+template <big_int_native_integer T>
+constexpr uint64_t big_int_native::magnitude(const T &integer)
+{
+    if constexpr (signed_integral<T>)
+    {
+        // The negation is done on the unsigned value so the smallest integer (ie INT64_MIN) does not overflow
+        return integer < 0 ? 0 - (uint64_t)integer : (uint64_t)integer;
+    }
+    else
+    {
+        return (uint64_t)integer;
+    }
+}
+
+template <big_int_native_integer T>
+constexpr bool big_int_native::negative(const T &integer)
+{
+    if constexpr (signed_integral<T>)
+    {
+        return integer < 0;
+    }
+    else
+    {
+        return false;
+    }
+}
+
+constexpr big_int big_int_native::copy(const big_int &integer, const uint64_t &extra)
+{
+    vector<uint32_t> digits;
+    digits.reserve(integer.coefficient.size() + extra);
+    digits.assign(integer.coefficient.begin(), integer.coefficient.end());
+    return big_int(std::move(digits), integer.integer_sign);
+}
+
+constexpr int big_int_native::compare_magnitude(const vector<uint32_t> &digits, const uint64_t &value_magnitude)
+{
+    uint64_t size = digits.size();
+    while (size > 1 && digits[size - 1] == 0)
+    {
+        size--;
+    }
+    if (size > 2)
+    {
+        return 1;
+    }
+    uint64_t value = digits[0] | (size == 2 ? (uint64_t)digits[1] << 32 : 0);
+    return value < value_magnitude ? -1 : (value > value_magnitude ? 1 : 0);
+}
+
+constexpr void big_int_native::add(big_int &integer, const uint64_t &value_magnitude, const bool &value_negative)
+{
+    if (value_magnitude == 0)
+    {
+        // Nothing to add, but a zero negated by the caller (ie 0 - x) must get its positive sign back
+        if (integer.is_zero())
+        {
+            integer.integer_sign = sign::POSITIVE;
+        }
+        return;
+    }
+    vector<uint32_t> &digits = integer.coefficient;
+    bool integer_zero = compare_magnitude(digits, 0) == 0;
+    bool integer_negative = integer.integer_sign == sign::NEGATIVE && !integer_zero;
+
+    // Add the magnitudes when both have the same sign, the carry is the rest of the value still to add
+    if (integer_negative == value_negative || integer_zero)
+    {
+        uint64_t carry = value_magnitude;
+        for (uint64_t i = 0; i < digits.size() && carry != 0; i++)
+        {
+            uint64_t temp = digits[i] + (carry & (uint64_t)UINT32_MAX);
+            digits[i] = (uint32_t)(temp & (uint64_t)UINT32_MAX);
+            carry = (carry >> 32) + (temp >> 32);
+        }
+        while (carry != 0)
+        {
+            digits.push_back((uint32_t)(carry & (uint64_t)UINT32_MAX));
+            carry >>= 32;
+        }
+        integer.integer_sign = value_negative ? sign::NEGATIVE : sign::POSITIVE;
+        integer.normalize();
+        return;
+    }
+
+    // Otherwise subtract the smaller magnitude from the larger one, the borrow is the rest of the value to subtract
+    if (compare_magnitude(digits, value_magnitude) >= 0)
+    {
+        uint64_t borrow = value_magnitude;
+        for (uint64_t i = 0; borrow != 0; i++)
+        {
+            uint64_t subtrahend = borrow & (uint64_t)UINT32_MAX;
+            uint64_t digit = digits[i];
+            digits[i] = (uint32_t)((digit + ((uint64_t)1 << 32) - subtrahend) & (uint64_t)UINT32_MAX);
+            borrow = (borrow >> 32) + (digit < subtrahend ? 1 : 0);
+        }
+    }
+    else
+    {
+        // The big integer has at most 2 coefficients and the value is larger, the sign is the one of the value
+        uint64_t value = digits[0] | (digits.size() > 1 ? (uint64_t)digits[1] << 32 : 0);
+        uint64_t difference = value_magnitude - value;
+        digits.assign(1, (uint32_t)(difference & (uint64_t)UINT32_MAX));
+        if (difference >> 32 != 0)
+        {
+            digits.push_back((uint32_t)(difference >> 32));
+        }
+        integer.integer_sign = value_negative ? sign::NEGATIVE : sign::POSITIVE;
+    }
+    integer.normalize();
+}
+
+constexpr void big_int_native::multiply(big_int &integer, const uint64_t &value_magnitude, const bool &value_negative)
+{
+    vector<uint32_t> &digits = integer.coefficient;
+    if (value_magnitude == 0)
+    {
+        digits.assign(1, 0);
+        integer.integer_sign = sign::POSITIVE;
+        return;
+    }
+
+    uint64_t low = value_magnitude & (uint64_t)UINT32_MAX;
+    uint64_t high = value_magnitude >> 32;
+    uint64_t carry = 0;
+    if (high == 0)
+    {
+        for (uint32_t &digit : digits)
+        {
+            uint64_t temp = digit * low + carry;
+            digit = (uint32_t)(temp & (uint64_t)UINT32_MAX);
+            carry = temp >> 32;
+        }
+    }
+    else
+    {
+        // Coefficient i of the product is digit i * low + digit (i - 1) * high + carry, the previous digit is kept
+        // since it has been replaced by then
+        uint64_t previous = 0;
+        for (uint32_t &digit : digits)
+        {
+            uint64_t low_product = digit * low;
+            uint64_t high_product = previous * high;
+            uint64_t sum = (low_product & (uint64_t)UINT32_MAX) + (high_product & (uint64_t)UINT32_MAX) + (carry & (uint64_t)UINT32_MAX);
+            carry = (low_product >> 32) + (high_product >> 32) + (carry >> 32) + (sum >> 32);
+            previous = digit;
+            digit = (uint32_t)(sum & (uint64_t)UINT32_MAX);
+        }
+        carry += previous * high;
+    }
+    while (carry != 0)
+    {
+        digits.push_back((uint32_t)(carry & (uint64_t)UINT32_MAX));
+        carry >>= 32;
+    }
+    if (value_negative)
+    {
+        integer.negate();
+    }
+    integer.normalize();
+}
+
+constexpr int big_int_native::compare(const big_int &integer, const uint64_t &value_magnitude, const bool &value_negative)
+{
+    bool integer_negative = integer.integer_sign == sign::NEGATIVE && compare_magnitude(integer.coefficient, 0) != 0;
+    bool negative_value = value_negative && value_magnitude != 0;
+    if (integer_negative != negative_value)
+    {
+        return integer_negative ? -1 : 1;
+    }
+    int magnitude_order = compare_magnitude(integer.coefficient, value_magnitude);
+    return integer_negative ? -magnitude_order : magnitude_order;
+}
+
+/************************** Operator Overloads *************************/
+/**
+ * @brief Operator overload for + with an integer of a built in type
+ * @param int_a The big_int to be added
+ * @param int_b The integer to be added
+ * @return The sum
+ */
+template <big_int_native_integer T>
+constexpr big_int operator+(const big_int &int_a, const T &int_b)
+{
+    big_int result = big_int_native::copy(int_a, 2);
+    big_int_native::add(result, big_int_native::magnitude(int_b), big_int_native::negative(int_b));
+    return result;
+}
+
+/**
+ * @brief Operator overload for + with an integer of a built in type
+ * @param int_a The integer to be added
+ * @param int_b The big_int to be added
+ * @return The sum
+ */
+template <big_int_native_integer T>
+constexpr big_int operator+(const T &int_a, const big_int &int_b)
+{
+    return int_b + int_a;
+}
+
+/**
+ * @brief Operator overload for - with an integer of a built in type
+ * @param int_a The big_int to be subtracted from
+ * @param int_b The integer to subtract
+ * @return The difference
+ */
+template <big_int_native_integer T>
+constexpr big_int operator-(const big_int &int_a, const T &int_b)
+{
+    big_int result = big_int_native::copy(int_a, 2);
+    big_int_native::add(result, big_int_native::magnitude(int_b), !big_int_native::negative(int_b));
+    return result;
+}
+
+/**
+ * @brief Operator overload for - with an integer of a built in type
+ * @param int_a The integer to be subtracted from
+ * @param int_b The big_int to subtract
+ * @return The difference
+ */
+template <big_int_native_integer T>
+constexpr big_int operator-(const T &int_a, const big_int &int_b)
+{
+    big_int result = big_int_native::copy(int_b, 2);
+    result.negate();
+    big_int_native::add(result, big_int_native::magnitude(int_a), big_int_native::negative(int_a));
+    return result;
+}
+
+/**
+ * @brief Operator overload for * with an integer of a built in type
+ * @param int_a The big_int to be multiplied
+ * @param int_b The integer to multiply by
+ * @return The product
+ */
+template <big_int_native_integer T>
+constexpr big_int operator*(const big_int &int_a, const T &int_b)
+{
+    big_int result = big_int_native::copy(int_a, 2);
+    big_int_native::multiply(result, big_int_native::magnitude(int_b), big_int_native::negative(int_b));
+    return result;
+}
+
+/**
+ * @brief Operator overload for * with an integer of a built in type
+ * @param int_a The integer to multiply by
+ * @param int_b The big_int to be multiplied
+ * @return The product
+ */
+template <big_int_native_integer T>
+constexpr big_int operator*(const T &int_a, const big_int &int_b)
+{
+    return int_b * int_a;
+}
+
+/**
+ * @brief Operator overload for / with an integer of a built in type, the quotient is rounded towards zero
+ * @details Throws the exception division_by_zero if the integer is zero
+ * @param dividend The big_int to divide
+ * @param divisor The integer to divide by
+ * @return The quotient
+ */
+template <big_int_native_integer T>
+big_int operator/(const big_int &dividend, const T &divisor)
+{
+    big_int result(dividend);
+    big_int_native::divide(result, big_int_native::magnitude(divisor), big_int_native::negative(divisor));
+    return result;
+}
+
+/**
+ * @brief Operator overload for % with an integer of a built in type, the remainder has the sign of the dividend
+ * @details Throws the exception division_by_zero if the integer is zero
+ * @param dividend The big_int to divide
+ * @param divisor The integer to divide by
+ * @return The remainder, dividend - (dividend / divisor) * divisor
+ */
+template <big_int_native_integer T>
+big_int operator%(const big_int &dividend, const T &divisor)
+{
+    return big_int_native::remainder_of(dividend, big_int_native::magnitude(divisor));
+}
+
+/**
+ * @brief Operator overload for += with an integer of a built in type
+ * @param integer The big_int to add to
+ * @param value The integer to add
+ * @return A reference to the big_int
+ */
+template <big_int_native_integer T>
+constexpr big_int &operator+=(big_int &integer, const T &value)
+{
+    big_int_native::add(integer, big_int_native::magnitude(value), big_int_native::negative(value));
+    return integer;
+}
+
+/**
+ * @brief Operator overload for -= with an integer of a built in type
+ * @param integer The big_int to subtract from
+ * @param value The integer to subtract
+ * @return A reference to the big_int
+ */
+template <big_int_native_integer T>
+constexpr big_int &operator-=(big_int &integer, const T &value)
+{
+    big_int_native::add(integer, big_int_native::magnitude(value), !big_int_native::negative(value));
+    return integer;
+}
+
+/**
+ * @brief Operator overload for *= with an integer of a built in type
+ * @param integer The big_int to multiply
+ * @param value The integer to multiply by
+ * @return A reference to the big_int
+ */
+template <big_int_native_integer T>
+constexpr big_int &operator*=(big_int &integer, const T &value)
+{
+    big_int_native::multiply(integer, big_int_native::magnitude(value), big_int_native::negative(value));
+    return integer;
+}
+
+/**
+ * @brief Operator overload for /= with an integer of a built in type, the quotient is rounded towards zero
+ * @details Throws the exception division_by_zero if the integer is zero
+ * @param integer The big_int to divide
+ * @param value The integer to divide by
+ * @return A reference to the big_int
+ */
+template <big_int_native_integer T>
+big_int &operator/=(big_int &integer, const T &value)
+{
+    big_int_native::divide(integer, big_int_native::magnitude(value), big_int_native::negative(value));
+    return integer;
+}
+
+/**
+ * @brief Operator overload for %= with an integer of a built in type, the remainder has the sign of the big_int
+ * @details Throws the exception division_by_zero if the integer is zero
+ * @param integer The big_int to divide, set to the remainder
+ * @param value The integer to divide by
+ * @return A reference to the big_int
+ */
+template <big_int_native_integer T>
+big_int &operator%=(big_int &integer, const T &value)
+{
+    big_int_native::remainder(integer, big_int_native::magnitude(value));
+    return integer;
+}
+
+/**
+ * @brief Operator overload for == with an integer of a built in type
+ * @param int_a The big_int to compare
+ * @param int_b The integer to compare
+ * @return A boolean value stating if int_a == int_b
+ */
+template <big_int_native_integer T>
+constexpr bool operator==(const big_int &int_a, const T &int_b)
+{
+    return big_int_native::compare(int_a, big_int_native::magnitude(int_b), big_int_native::negative(int_b)) == 0;
+}
+
+/**
+ * @brief Operator overload for != with an integer of a built in type
+ * @param int_a The big_int to compare
+ * @param int_b The integer to compare
+ * @return A boolean value stating if int_a != int_b
+ */
+template <big_int_native_integer T>
+constexpr bool operator!=(const big_int &int_a, const T &int_b)
+{
+    return !(int_a == int_b);
+}
+
+/**
+ * @brief Operator overload for < with an integer of a built in type
+ * @param int_a The big_int to compare
+ * @param int_b The integer to compare
+ * @return A boolean value stating if int_a < int_b
+ */
+template <big_int_native_integer T>
+constexpr bool operator<(const big_int &int_a, const T &int_b)
+{
+    return big_int_native::compare(int_a, big_int_native::magnitude(int_b), big_int_native::negative(int_b)) < 0;
+}
+
+/**
+ * @brief Operator overload for > with an integer of a built in type
+ * @param int_a The big_int to compare
+ * @param int_b The integer to compare
+ * @return A boolean value stating if int_a > int_b
+ */
+template <big_int_native_integer T>
+constexpr bool operator>(const big_int &int_a, const T &int_b)
+{
+    return big_int_native::compare(int_a, big_int_native::magnitude(int_b), big_int_native::negative(int_b)) > 0;
+}
+
+/**
+ * @brief Operator overload for <=> with an integer of a built in type, also gives the operators <= and >= in both orders
+ * @param int_a The big_int to compare
+ * @param int_b The integer to compare
+ * @return strong_ordering::less, equal or greater as int_a is less than, equal to or greater than int_b
+ */
+template <big_int_native_integer T>
+constexpr strong_ordering operator<=>(const big_int &int_a, const T &int_b)
+{
+    return big_int_native::compare(int_a, big_int_native::magnitude(int_b), big_int_native::negative(int_b)) <=> 0;
+}
+
+/**
+ * @brief Operator overload for == with an integer of a built in type
+ * @param int_a The integer to compare
+ * @param int_b The big_int to compare
+ * @return A boolean value stating if int_a == int_b
+ */
+template <big_int_native_integer T>
+constexpr bool operator==(const T &int_a, const big_int &int_b)
+{
+    return int_b == int_a;
+}
+
+/**
+ * @brief Operator overload for != with an integer of a built in type
+ * @param int_a The integer to compare
+ * @param int_b The big_int to compare
+ * @return A boolean value stating if int_a != int_b
+ */
+template <big_int_native_integer T>
+constexpr bool operator!=(const T &int_a, const big_int &int_b)
+{
+    return !(int_b == int_a);
+}
+
+/**
+ * @brief Operator overload for < with an integer of a built in type
+ * @param int_a The integer to compare
+ * @param int_b The big_int to compare
+ * @return A boolean value stating if int_a < int_b
+ */
+template <big_int_native_integer T>
+constexpr bool operator<(const T &int_a, const big_int &int_b)
+{
+    return int_b > int_a;
+}
+
+/**
+ * @brief Operator overload for > with an integer of a built in type
+ * @param int_a The integer to compare
+ * @param int_b The big_int to compare
+ * @return A boolean value stating if int_a > int_b
+ */
+template <big_int_native_integer T>
+constexpr bool operator>(const T &int_a, const big_int &int_b)
+{
+    return int_b < int_a;
+}
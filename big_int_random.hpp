@@ -0,0 +1,290 @@
+#pragma once
+/**
+ * @file big_int_random.hpp
+ * @author Gabrielle Ching-Johnson
+ * @brief Header file for random big integers made directly from the words of a random number generator
+ * @version 0.3
+ * @date Oct 18, 2026
+ */
+
+#include <vector>
+#include <cstdint>
+#include <limits>
+#include <bit>
+#include <random>
+#include <stdexcept>
+#include "big_int.hpp"
+using namespace std;
+
+/*
+ * The coefficients of a random big integer are filled directly with the words of a random number generator (any
+ * uniform random bit generator of <random>, ie mt19937_64), two coefficients per 64 bit word, without going through a
+ * string. random_below() uses rejection sampling: a value of the number of bits of the bound is drawn until it is
+ * below the bound, which takes less than two draws on average, and a draw is rejected as soon as its most significant
+ * coefficient is above the one of the bound, thus the values are exactly uniform.
+ *
+ * The time is mostly spent in the generator: mt19937_64 takes several nanoseconds per word, xoshiro256_engine below
+ * about one, thus a million integers of 4096 bits take about a tenth of a second with it.
+ */
+
+/***************************** Exceptions ***************************/
+/**
+ * @brief Exception to be thrown if the bound of a random big integer is not positive
+ */
+class invalid_random_bound : public invalid_argument
+{
+public:
+    invalid_random_bound() : invalid_argument("The bound of a random big integer must be positive"){};
+};
+
+/**
+ * @brief A fast random number generator of 64 bit words (xoshiro256** of Blackman and Vigna), it is a uniform random bit
+ *        generator of <random> thus it can be used with random_bits(), random_below() and the distributions
+ * @details Not suitable for cryptography
+ */
+class xoshiro256_engine
+{
+public:
+    using result_type = uint64_t;
+
+    /**
+     * @brief Initialize the generator, the same seed gives the same words
+     * @param seed The seed, expanded to the state with splitmix64
+     */
+    explicit xoshiro256_engine(const uint64_t &seed = 1)
+    {
+        uint64_t mixed = seed;
+        for (uint64_t &word : state)
+        {
+            mixed += 0x9e3779b97f4a7c15;
+            uint64_t z = mixed;
+            z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9;
+            z = (z ^ (z >> 27)) * 0x94d049bb133111eb;
+            word = z ^ (z >> 31);
+        }
+    }
+
+    static constexpr result_type min()
+    {
+        return 0;
+    }
+
+    static constexpr result_type max()
+    {
+        return numeric_limits<uint64_t>::max();
+    }
+
+    /**
+     * @brief Gets the next word
+     * @return 64 random bits
+     */
+    result_type operator()()
+    {
+        uint64_t result = rotl(state[1] * 5, 7) * 9;
+        uint64_t shifted = state[1] << 17;
+        state[2] ^= state[0];
+        state[3] ^= state[1];
+        state[1] ^= state[2];
+        state[0] ^= state[3];
+        state[2] ^= shifted;
+        state[3] = rotl(state[3], 45);
+        return result;
+    }
+
+private:
+    uint64_t state[4];
+};
+
+/**
+ * @brief This class fills the coefficients of random big integers, see random_bits() and random_below()
+ */
+class big_int_random
+{
+public:
+    /**
+     * @brief Creates a random big integer of at most a number of bits
+     * @param bits The number of bits
+     * @param generator The random number generator
+     * @return A big_int uniformly distributed in [0, 2^bits)
+     */
+    template <class random_generator>
+    static big_int bits(const uint64_t &bits, random_generator &generator);
+
+    /**
+     * @brief Creates a random big integer below a bound
+     * @details Throws the exception invalid_random_bound if the bound is not positive
+     * @param bound The bound, positive
+     * @param generator The random number generator
+     * @return A big_int uniformly distributed in [0, bound)
+     */
+    template <class random_generator>
+    static big_int below(const big_int &bound, random_generator &generator);
+
+private:
+    /**
+     * @brief Gets 64 random bits from a generator
+     * @param generator The random number generator
+     * @return The random bits
+     */
+    template <class random_generator>
+    static uint64_t next_word(random_generator &generator);
+
+    /**
+     * @brief Fills coefficients with random bits
+     * @param digits The first coefficient to fill
+     * @param count The number of coefficients to fill
+     * @param generator The random number generator
+     */
+    template <class random_generator>
+    static void fill(uint32_t *digits, const uint64_t &count, random_generator &generator);
+
+    /**
+     * @brief Removes the leading zero coefficients of a random big integer, it keeps one coefficient if it is zero
+     * @param integer The big_int
+     */
+    static void trim(big_int &integer);
+};
+
+/**
+ * @brief Creates a random big integer of at most a number of bits
+ * @param bits The number of bits
+ * @param generator The random number generator (ie mt19937_64)
+ * @return A big_int uniformly distributed in [0, 2^bits)
+ */
+template <class random_generator>
+big_int random_bits(const uint64_t &bits, random_generator &generator)
+{
+    return big_int_random::bits(bits, generator);
+}
+
+/**
+ * @brief Creates a random big integer below a bound
+ * @details Throws the exception invalid_random_bound if the bound is not positive
+ * @param bound The bound, positive
+ * @param generator The random number generator (ie mt19937_64)
+ * @return A big_int uniformly distributed in [0, bound)
+ */
+template <class random_generator>
+big_int random_below(const big_int &bound, random_generator &generator)
+{
+    return big_int_random::below(bound, generator);
+}
+
+/************************** Filling the Coefficients *************************/
+template <class random_generator>
+uint64_t big_int_random::next_word(random_generator &generator)
+{
+    // Generators of 64 or 32 bit words are used directly, the others through a distribution
+    constexpr uint64_t low = random_generator::min();
+    constexpr uint64_t high = random_generator::max();
+    if constexpr (low == 0 && high == numeric_limits<uint64_t>::max())
+    {
+        return (uint64_t)generator();
+    }
+    else if constexpr (low == 0 && high == numeric_limits<uint32_t>::max())
+    {
+        uint64_t upper = (uint64_t)generator();
+        return upper << 32 | (uint64_t)generator();
+    }
+    else
+    {
+        uniform_int_distribution<uint64_t> distribution;
+        return distribution(generator);
+    }
+}
+
+template <class random_generator>
+void big_int_random::fill(uint32_t *digits, const uint64_t &count, random_generator &generator)
+{
+    uint64_t i = 0;
+    for (; i + 1 < count; i += 2)
+    {
+        uint64_t word = next_word(generator);
+        digits[i] = (uint32_t)word;
+        digits[i + 1] = (uint32_t)(word >> 32);
+    }
+    if (i < count)
+    {
+        digits[i] = (uint32_t)next_word(generator);
+    }
+}
+
+inline void big_int_random::trim(big_int &integer)
+{
+    while (integer.coefficient.size() > 1 && integer.coefficient.back() == 0)
+    {
+        integer.coefficient.pop_back();
+    }
+}
+
+template <class random_generator>
+big_int big_int_random::bits(const uint64_t &bits, random_generator &generator)
+{
+    big_int result;
+    if (bits == 0)
+    {
+        return result;
+    }
+    uint64_t size = (bits + 31) / 32;
+    vector<uint32_t> digits(size);
+    fill(digits.data(), size, generator);
+
+    // Only the low bits of the most significant coefficient are kept
+    uint64_t top_bits = bits - 32 * (size - 1);
+    if (top_bits < 32)
+    {
+        digits.back() &= ((uint32_t)1 << top_bits) - 1;
+    }
+    result.coefficient = std::move(digits);
+    trim(result);
+    return result;
+}
+
+template <class random_generator>
+big_int big_int_random::below(const big_int &bound, random_generator &generator)
+{
+    // The vector constructor keeps leading zeros
+    uint64_t size = bound.coefficient.size();
+    while (size > 1 && bound.coefficient[size - 1] == 0)
+    {
+        size--;
+    }
+    uint32_t top = bound.coefficient[size - 1];
+    if (bound.integer_sign == sign::NEGATIVE || (size == 1 && top == 0))
+    {
+        throw invalid_random_bound();
+    }
+
+    // The most significant coefficient is drawn with the bits of the one of the bound
+    uint32_t mask = numeric_limits<uint32_t>::max() >> countl_zero(top);
+    vector<uint32_t> digits(size);
+    while (true)
+    {
+        uint32_t candidate = (uint32_t)next_word(generator) & mask;
+        if (candidate > top)
+        {
+            continue;
+        }
+        digits[size - 1] = candidate;
+        fill(digits.data(), size - 1, generator);
+        if (candidate < top)
+        {
+            break;
+        }
+
+        // The most significant coefficients are equal, the next different one decides
+        uint64_t i = size - 1;
+        while (i > 0 && digits[i - 1] == bound.coefficient[i - 1])
+        {
+            i--;
+        }
+        if (i > 0 && digits[i - 1] < bound.coefficient[i - 1])
+        {
+            break;
+        }
+    }
+    big_int result;
+    result.coefficient = std::move(digits);
+    trim(result);
+    return result;
+}
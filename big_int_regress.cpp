@@ -0,0 +1,394 @@
+/**
+ * @file big_int_regress.cpp
+ * @author Gabrielle Ching-Johnson
+ * @brief C++ code file for the performance regression gate that compares benchmark results with a baseline
+ * @version 0.3
+ * @date Oct 18, 2026
+ */
+
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <cstdlib>
+#include <cctype>
+#include <cmath>
+#include <map>
+#include <sstream>
+#include <iomanip>
+#include <iostream>
+#include <algorithm>
+#include "big_int_regress.hpp"
+using namespace std;
+
+/******************************* Reading Results ******************************/
+/**
+ * @brief A JSON value, only the parts used by the results of a run are kept
+ */
+struct json_value
+{
+    double number = 0;
+    string text;
+    vector<json_value> items;
+    map<string, json_value> members;
+};
+
+/**
+ * @brief Reads JSON values from a string, throws the exception invalid_bench_json if the JSON is malformed
+ */
+class json_reader
+{
+public:
+    /**
+     * @brief Creates a reader at the start of a string
+     * @param json The JSON, it must outlive the reader
+     */
+    json_reader(const string &json) : text(json) {}
+
+    /**
+     * @brief Reads the whole string as one value
+     * @return The value
+     */
+    json_value read_document()
+    {
+        json_value value = read_value();
+        skip_space();
+        if (position != text.size())
+        {
+            throw invalid_bench_json("unexpected data after the JSON");
+        }
+        return value;
+    }
+
+private:
+    // The JSON being read
+    const string &text;
+
+    // Index of the next character to read
+    uint64_t position = 0;
+
+    /**
+     * @brief Moves past any white space
+     */
+    void skip_space()
+    {
+        while (position < text.size() && isspace((unsigned char)text[position]))
+        {
+            position++;
+        }
+    }
+
+    /**
+     * @brief Moves past a character, throws if it is not next
+     * @param character The character
+     */
+    void expect(const char &character)
+    {
+        skip_space();
+        if (position >= text.size() || text[position] != character)
+        {
+            throw invalid_bench_json(string("expected '") + character + "' at character " + to_string(position));
+        }
+        position++;
+    }
+
+    /**
+     * @brief Checks if another item of an object or array follows and moves past its comma
+     * @return True if a comma is next
+     */
+    bool next_item()
+    {
+        skip_space();
+        if (position < text.size() && text[position] == ',')
+        {
+            position++;
+            return true;
+        }
+        return false;
+    }
+
+    /**
+     * @brief Reads a value, an object, array, string, number or literal
+     * @return The value
+     */
+    json_value read_value()
+    {
+        skip_space();
+        if (position >= text.size())
+        {
+            throw invalid_bench_json("unexpected end of the JSON");
+        }
+        json_value value;
+        const char &first = text[position];
+        if (first == '{')
+        {
+            position++;
+            skip_space();
+            if (position < text.size() && text[position] == '}')
+            {
+                position++;
+                return value;
+            }
+            do
+            {
+                skip_space();
+                string key = read_string();
+                expect(':');
+                value.members[key] = read_value();
+            } while (next_item());
+            expect('}');
+        }
+        else if (first == '[')
+        {
+            position++;
+            skip_space();
+            if (position < text.size() && text[position] == ']')
+            {
+                position++;
+                return value;
+            }
+            do
+            {
+                value.items.push_back(read_value());
+            } while (next_item());
+            expect(']');
+        }
+        else if (first == '"')
+        {
+            value.text = read_string();
+        }
+        else if (text.compare(position, 4, "true") == 0)
+        {
+            value.number = 1;
+            position += 4;
+        }
+        else if (text.compare(position, 4, "null") == 0)
+        {
+            position += 4;
+        }
+        else if (text.compare(position, 5, "false") == 0)
+        {
+            position += 5;
+        }
+        else
+        {
+            const char *start = text.c_str() + position;
+            char *end = nullptr;
+            value.number = strtod(start, &end);
+            if (end == start)
+            {
+                throw invalid_bench_json("unexpected character at character " + to_string(position));
+            }
+            position += (uint64_t)(end - start);
+        }
+        return value;
+    }
+
+    /**
+     * @brief Reads a string in quotes
+     * @return The string without its quotes
+     */
+    string read_string()
+    {
+        if (position >= text.size() || text[position] != '"')
+        {
+            throw invalid_bench_json("expected a string at character " + to_string(position));
+        }
+        position++;
+        string result;
+        while (position < text.size() && text[position] != '"')
+        {
+            // write_json only escapes " and \ so the escaped character is kept as is
+            if (text[position] == '\\' && position + 1 < text.size())
+            {
+                position++;
+            }
+            result += text[position++];
+        }
+        if (position >= text.size())
+        {
+            throw invalid_bench_json("unterminated string");
+        }
+        position++;
+        return result;
+    }
+};
+
+/**
+ * @brief Gets a member of a JSON object, throws the exception invalid_bench_json if it is missing
+ * @param object The object
+ * @param key The name of the member
+ * @return The member
+ */
+static const json_value &json_member(const json_value &object, const string &key)
+{
+    map<string, json_value>::const_iterator member = object.members.find(key);
+    if (member == object.members.end())
+    {
+        throw invalid_bench_json("missing \"" + key + "\"");
+    }
+    return member->second;
+}
+
+vector<bench_result> read_json(istream &in, bench_options &options)
+{
+    stringstream buffer;
+    buffer << in.rdbuf();
+    string text = buffer.str();
+    json_value document = json_reader(text).read_document();
+
+    const json_value &context = json_member(document, "context");
+    options.min_time = json_member(context, "min_time").number;
+    options.repetitions = (uint64_t)json_member(context, "repetitions").number;
+    options.max_limbs = (uint64_t)json_member(context, "max_limbs").number;
+    options.full = json_member(context, "full").number != 0;
+
+    vector<bench_result> results;
+    for (const json_value &benchmark : json_member(document, "benchmarks").items)
+    {
+        bench_result result;
+        result.name = json_member(benchmark, "name").text;
+        result.limbs = (uint64_t)json_member(benchmark, "limbs").number;
+        result.iterations = (uint64_t)json_member(benchmark, "iterations").number;
+        const json_value &time = json_member(benchmark, "ns_per_op");
+        result.mean = json_member(time, "mean").number;
+        result.median = json_member(time, "median").number;
+        result.min = json_member(time, "min").number;
+        result.max = json_member(time, "max").number;
+        result.stddev = json_member(time, "stddev").number;
+        for (const json_value &sample : json_member(time, "samples").items)
+        {
+            result.samples.push_back(sample.number);
+        }
+        result.limbs_per_second = json_member(benchmark, "limbs_per_second").number;
+        result.allocations_per_op = json_member(benchmark, "allocations_per_op").number;
+        results.push_back(result);
+    }
+    return results;
+}
+
+/******************************* Regression Gate ******************************/
+bench_comparison compare_result(const bench_result &baseline, const bench_result &current, const double &tolerance)
+{
+    bench_comparison comparison;
+    comparison.name = current.name;
+    comparison.limbs = current.limbs;
+    comparison.baseline_time = baseline.min;
+    comparison.current_time = current.min;
+    comparison.change = baseline.min > 0 ? current.min / baseline.min - 1 : 0;
+    comparison.tolerance = tolerance;
+    comparison.baseline_allocations = baseline.allocations_per_op;
+    comparison.current_allocations = current.allocations_per_op;
+
+    // Welch's t statistic, the standard error is never taken as zero so identical samples are not significant
+    double baseline_variance = baseline.stddev * baseline.stddev / (double)max<uint64_t>(baseline.samples.size(), 1);
+    double current_variance = current.stddev * current.stddev / (double)max<uint64_t>(current.samples.size(), 1);
+    double error = max(sqrt(baseline_variance + current_variance), 1e-3 * max(baseline.mean, current.mean));
+    comparison.t_statistic = error > 0 ? (current.mean - baseline.mean) / error : 0;
+
+    if (current.allocations_per_op > 1.01 * baseline.allocations_per_op + 0.5)
+    {
+        comparison.status = bench_status::MORE_ALLOCATIONS;
+    }
+    else if (comparison.change > tolerance && comparison.t_statistic > regression_t_statistic)
+    {
+        comparison.status = bench_status::SLOWER;
+    }
+    else if (comparison.change < -tolerance && comparison.t_statistic < -regression_t_statistic)
+    {
+        comparison.status = bench_status::FASTER;
+    }
+    return comparison;
+}
+
+vector<bench_comparison> compare_results(const vector<bench_case> &benchmarks, const vector<bench_result> &baseline,
+                                         const vector<bench_result> &current, const double &tolerance_scale)
+{
+    map<string, double> tolerances;
+    for (const bench_case &benchmark : benchmarks)
+    {
+        tolerances[benchmark.name] = benchmark.tolerance * tolerance_scale;
+    }
+    map<pair<string, uint64_t>, const bench_result *> baseline_results;
+    for (const bench_result &result : baseline)
+    {
+        baseline_results[{result.name, result.limbs}] = &result;
+    }
+
+    vector<bench_comparison> comparisons;
+    for (const bench_result &result : current)
+    {
+        map<pair<string, uint64_t>, const bench_result *>::iterator match = baseline_results.find({result.name, result.limbs});
+        if (match == baseline_results.end())
+        {
+            bench_comparison comparison;
+            comparison.name = result.name;
+            comparison.limbs = result.limbs;
+            comparison.current_time = result.min;
+            comparison.current_allocations = result.allocations_per_op;
+            comparison.status = bench_status::NEW;
+            comparisons.push_back(comparison);
+            continue;
+        }
+        map<string, double>::const_iterator tolerance = tolerances.find(result.name);
+        comparisons.push_back(compare_result(*match->second, result, tolerance == tolerances.end() ? 0.1 * tolerance_scale : tolerance->second));
+        baseline_results.erase(match);
+    }
+
+    // Results of the baseline that were not run
+    for (const bench_result &result : baseline)
+    {
+        if (baseline_results.count({result.name, result.limbs}) == 1)
+        {
+            bench_comparison comparison;
+            comparison.name = result.name;
+            comparison.limbs = result.limbs;
+            comparison.baseline_time = result.min;
+            comparison.baseline_allocations = result.allocations_per_op;
+            comparison.status = bench_status::MISSING;
+            comparisons.push_back(comparison);
+        }
+    }
+    return comparisons;
+}
+
+bool is_regression(const bench_comparison &comparison)
+{
+    return comparison.status == bench_status::SLOWER || comparison.status == bench_status::MORE_ALLOCATIONS ||
+           comparison.status == bench_status::MISSING;
+}
+
+void write_report(ostream &out, const vector<bench_comparison> &comparisons)
+{
+    static const char *status_names[] = {"ok", "faster", "SLOWER", "MORE ALLOCATIONS", "MISSING", "new"};
+    out << left << setw(18) << "benchmark" << right << setw(9) << "limbs" << setw(16) << "baseline ns" << setw(16)
+        << "current ns" << setw(10) << "change" << setw(8) << "limit" << setw(8) << "t" << setw(14) << "allocations"
+        << "  status\n";
+
+    uint64_t regressions = 0;
+    uint64_t faster = 0;
+    for (const bench_comparison &comparison : comparisons)
+    {
+        out << left << setw(18) << comparison.name << right << setw(9) << comparison.limbs << fixed << setprecision(1);
+        if (comparison.status == bench_status::NEW)
+            out << setw(16) << "-";
+        else
+            out << setw(16) << comparison.baseline_time;
+        if (comparison.status == bench_status::MISSING)
+            out << setw(16) << "-";
+        else
+            out << setw(16) << comparison.current_time;
+        if (comparison.status == bench_status::NEW || comparison.status == bench_status::MISSING)
+        {
+            out << setw(10) << "-" << setw(8) << "-" << setw(8) << "-" << setw(14) << "-";
+        }
+        else
+        {
+            out << setw(9) << showpos << 100 * comparison.change << "%" << noshowpos << setw(7) << 100 * comparison.tolerance
+                << "%" << setw(8) << comparison.t_statistic << setw(14) << setprecision(2) << comparison.current_allocations;
+        }
+        out << "  " << status_names[(int)comparison.status] << "\n";
+        regressions += is_regression(comparison) ? 1 : 0;
+        faster += comparison.status == bench_status::FASTER ? 1 : 0;
+    }
+    out << "\n" << comparisons.size() << " results compared, " << regressions << " regressions, " << faster << " faster\n";
+}
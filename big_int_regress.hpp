@@ -0,0 +1,128 @@
+#pragma once
+/**
+ * @file big_int_regress.hpp
+ * @author Gabrielle Ching-Johnson
+ * @brief Header file for the performance regression gate that compares benchmark results with a baseline
+ * @version 0.3
+ * @date Oct 18, 2026
+ */
+
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <iostream>
+#include <stdexcept>
+#include "big_int_bench.hpp"
+using namespace std;
+
+/***************************** Exceptions ***************************/
+/**
+ * @brief Exception to be thrown if a file of benchmark results is not in the JSON written by write_json
+ */
+class invalid_bench_json : public invalid_argument
+{
+public:
+    invalid_bench_json(const string &reason) : invalid_argument("The benchmark results are not valid: " + reason){};
+};
+
+/************************** Reading Results *************************/
+/**
+ * @brief Reads the results of a run written by write_json
+ * @details Throws the exception invalid_bench_json if the data is not the JSON of a run
+ * @param in The stream to read from
+ * @param options Set to the settings of the run
+ * @return The results
+ */
+vector<bench_result> read_json(istream &in, bench_options &options);
+
+/***************************** Regression Gate ***************************/
+/*
+ * A result is a regression if its fastest repetition is slower than the fastest repetition of the baseline by more
+ * than the tolerance of its benchmark AND the difference of the means is statistically significant, that is more than
+ * regression_t_statistic standard errors (Welch's t statistic of the two sets of repetitions). Both are needed since
+ * small operands have noisy timings and large operands have few but very consistent repetitions. The number of
+ * allocations does not depend on the machine, thus an increase of more than 1% and half an allocation per operation
+ * is a regression too.
+ */
+
+// Smallest t statistic of the difference of the means that is not considered noise
+constexpr double regression_t_statistic = 3.0;
+
+/**
+ * @brief The outcome of comparing a result with the baseline
+ */
+enum class bench_status
+{
+    UNCHANGED,
+    FASTER,
+    SLOWER,
+    MORE_ALLOCATIONS,
+    MISSING,
+    NEW
+};
+
+/**
+ * @brief The comparison of one benchmark at one size with the baseline
+ */
+struct bench_comparison
+{
+    // Name of the operation
+    string name;
+
+    // Number of coefficients of the operands
+    uint64_t limbs = 0;
+
+    // Nanoseconds per operation of the fastest repetition, which is the least disturbed by other processes, 0 if there
+    // is no result
+    double baseline_time = 0;
+    double current_time = 0;
+
+    // Relative change of the fastest repetition (ie 0.25 is 25% slower)
+    double change = 0;
+
+    // Welch's t statistic of the difference of the means, positive if slower
+    double t_statistic = 0;
+
+    // Largest accepted change of the fastest repetition
+    double tolerance = 0;
+
+    // Allocations per operation
+    double baseline_allocations = 0;
+    double current_allocations = 0;
+
+    bench_status status = bench_status::UNCHANGED;
+};
+
+/**
+ * @brief Compares one result with its baseline
+ * @param baseline The result of the baseline
+ * @param current The result of the current run, for the same benchmark and size
+ * @param tolerance The largest accepted slowdown of the fastest repetition
+ * @return The comparison, with a status of UNCHANGED, FASTER, SLOWER or MORE_ALLOCATIONS
+ */
+bench_comparison compare_result(const bench_result &baseline, const bench_result &current, const double &tolerance);
+
+/**
+ * @brief Compares every result of a run with the baseline
+ * @param benchmarks The benchmarks, for their tolerance
+ * @param baseline The results of the baseline
+ * @param current The results of the current run
+ * @param tolerance_scale Multiplies the tolerance of every benchmark
+ * @return The comparisons in the order of the current run, followed by the baseline results missing from it
+ */
+vector<bench_comparison> compare_results(const vector<bench_case> &benchmarks, const vector<bench_result> &baseline,
+                                         const vector<bench_result> &current, const double &tolerance_scale = 1.0);
+
+/**
+ * @brief Checks if a comparison is a regression
+ * @param comparison The comparison
+ * @return True if the status is SLOWER, MORE_ALLOCATIONS or MISSING
+ */
+bool is_regression(const bench_comparison &comparison);
+
+/**
+ * @brief Writes a table of the comparisons, one line per benchmark and size, followed by a summary
+ * @param out The stream to write to
+ * @param comparisons The comparisons
+ */
+void write_report(ostream &out, const vector<bench_comparison> &comparisons);
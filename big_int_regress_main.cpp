@@ -0,0 +1,195 @@
+/**
+ * @file big_int_regress_main.cpp
+ * @author Gabrielle Ching-Johnson
+ * @brief Program that times every big_int operation and fails if one got slower than a stored baseline
+ * @version 0.3
+ * @date Oct 18, 2026
+ *
+ * Usage: big_int_regress --baseline=FILE [--update] [--tolerance-scale=X] [--filter=NAME] [--threads=N] [--output=FILE]
+ *                        [--max-limbs=N] [--min-time=SECONDS] [--repetitions=N] [--full]
+ *
+ * With --update the benchmarks are run and written to the baseline file. Otherwise the benchmarks are run with the
+ * settings stored in the baseline, every result is compared with the baseline and a report is written to the standard
+ * output. The exit status is 0 if there is no regression, 1 if there is one and 2 if the baseline can not be read.
+ */
+
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <stdexcept>
+#include "big_int_bench.hpp"
+#include "big_int_regress.hpp"
+#include "thread_pool.hpp"
+using namespace std;
+
+/**
+ * @brief Gets the value of a command line option of the form --name=value
+ * @param argument The command line argument
+ * @param name The name of the option with its dashes and equal sign (ie --baseline=)
+ * @param value Set to the value of the option if the argument is the option
+ * @return True if the argument is the option
+ */
+static bool option_value(const string &argument, const string &name, string &value)
+{
+    if (argument.compare(0, name.size(), name) != 0)
+    {
+        return false;
+    }
+    value = argument.substr(name.size());
+    return true;
+}
+
+/**
+ * @brief Writes results in JSON to a file
+ * @param path The path of the file
+ * @param results The results
+ * @param options The settings of the run
+ * @return True if the file was written
+ */
+static bool save_json(const string &path, const vector<bench_result> &results, const bench_options &options)
+{
+    ofstream file(path);
+    write_json(file, results, options);
+    file.close();
+    return (bool)file;
+}
+
+int main(int argc, char *argv[])
+{
+    bench_options options;
+    string baseline_path;
+    string output;
+    string filter;
+    double tolerance_scale = 1.0;
+    bool update = false;
+    try
+    {
+        for (int i = 1; i < argc; i++)
+        {
+            string argument = argv[i];
+            string value;
+            if (option_value(argument, "--baseline=", value))
+                baseline_path = value;
+            else if (option_value(argument, "--tolerance-scale=", value))
+                tolerance_scale = stod(value);
+            else if (option_value(argument, "--filter=", value))
+                filter = value;
+            else if (option_value(argument, "--threads=", value))
+                set_big_int_threads(stoull(value));
+            else if (option_value(argument, "--output=", value))
+                output = value;
+            else if (option_value(argument, "--max-limbs=", value))
+                options.max_limbs = stoull(value);
+            else if (option_value(argument, "--min-time=", value))
+                options.min_time = stod(value);
+            else if (option_value(argument, "--repetitions=", value))
+                options.repetitions = max(stoull(value), 1ULL);
+            else if (argument == "--full")
+                options.full = true;
+            else if (argument == "--update")
+                update = true;
+            else
+                throw invalid_argument("Unknown option " + argument);
+        }
+        if (baseline_path.empty())
+        {
+            throw invalid_argument("The option --baseline=FILE is required");
+        }
+    }
+    catch (const exception &e)
+    {
+        cerr << e.what() << "\nUsage: big_int_regress --baseline=FILE [--update] [--tolerance-scale=X] [--filter=NAME] "
+             << "[--threads=N] [--output=FILE] [--max-limbs=N] [--min-time=SECONDS] [--repetitions=N] [--full]\n";
+        return 2;
+    }
+
+    vector<bench_case> benchmarks = big_int_benchmarks();
+    if (update)
+    {
+        options.filter = filter;
+        vector<bench_result> results = run_benchmarks(benchmarks, options, cerr);
+        if (!save_json(baseline_path, results, options))
+        {
+            cerr << "Could not write " << baseline_path << "\n";
+            return 2;
+        }
+        cout << "Wrote " << results.size() << " results to " << baseline_path << "\n";
+        return 0;
+    }
+
+    // The run uses the settings of the baseline so the results are comparable
+    vector<bench_result> baseline;
+    try
+    {
+        ifstream file(baseline_path);
+        if (!file)
+        {
+            throw invalid_argument("Could not read " + baseline_path + ", create it with --update");
+        }
+        baseline = read_json(file, options);
+    }
+    catch (const exception &e)
+    {
+        cerr << e.what() << "\n";
+        return 2;
+    }
+    options.filter = filter;
+    vector<bench_result> filtered_baseline;
+    for (const bench_result &result : baseline)
+    {
+        if (result.name.find(filter) != string::npos)
+        {
+            filtered_baseline.push_back(result);
+        }
+    }
+
+    vector<bench_result> current = run_benchmarks(benchmarks, options, cerr);
+
+    // A slower result is timed up to twice more before it is reported, a one off hiccup of the machine is not a
+    // regression
+    vector<bench_comparison> comparisons = compare_results(benchmarks, filtered_baseline, current, tolerance_scale);
+    for (uint64_t attempt = 0; attempt < 2; attempt++)
+    {
+        for (const bench_comparison &comparison : comparisons)
+        {
+            if (comparison.status != bench_status::SLOWER)
+            {
+                continue;
+            }
+            for (const bench_case &benchmark : benchmarks)
+            {
+                if (benchmark.name != comparison.name)
+                {
+                    continue;
+                }
+                cerr << "Timing " << benchmark.name << " at " << comparison.limbs << " limbs again\n";
+                bench_result again = run_benchmark(benchmark, comparison.limbs, options);
+                for (bench_result &result : current)
+                {
+                    if (result.name == again.name && result.limbs == again.limbs && again.min < result.min)
+                    {
+                        result = again;
+                    }
+                }
+            }
+        }
+        comparisons = compare_results(benchmarks, filtered_baseline, current, tolerance_scale);
+    }
+
+    if (!output.empty() && !save_json(output, current, options))
+    {
+        cerr << "Could not write " << output << "\n";
+    }
+
+    write_report(cout, comparisons);
+    for (const bench_comparison &comparison : comparisons)
+    {
+        if (is_regression(comparison))
+        {
+            return 1;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,325 @@
+/**
+ * @file big_int_stats.cpp
+ * @author Gabrielle Ching-Johnson
+ * @brief C++ code file for the counters of the big_int operations, compiled in with the CMake option BIG_INT_INSTRUMENT
+ * @version 0.3
+ * @date Oct 18, 2026
+ */
+
+#include <iostream>
+#include <iomanip>
+#include <array>
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+#include <atomic>
+#include <mutex>
+#include <chrono>
+#include <bit>
+#include <algorithm>
+#include "big_int_stats.hpp"
+using namespace std;
+
+// Index of each counter of an operation in the counters of a thread, the sizes are last
+static const uint64_t count_index = 0;
+static const uint64_t nanoseconds_index = 1;
+static const uint64_t allocations_index = 2;
+static const uint64_t bytes_index = 3;
+static const uint64_t sizes_index = 4;
+static const uint64_t counters_per_operation = sizes_index + big_int_size_buckets;
+
+/**
+ * @brief The counters of one thread, only the thread writes them but snapshots read them from other threads
+ */
+struct thread_counters
+{
+    array<array<atomic<uint64_t>, counters_per_operation>, big_int_operation_count> values{};
+};
+
+/**
+ * @brief The counters of every thread
+ */
+struct counter_registry
+{
+    // Guards the other members
+    mutex lock;
+
+    // The counters of the running threads
+    vector<thread_counters *> threads;
+
+    // The counters of the threads that have exited
+    big_int_stats retired;
+
+    // The total of the counters at the last reset
+    big_int_stats reset_point;
+};
+
+/**
+ * @brief Gets the registry of the counters of every thread
+ * @details It is never destroyed, since the threads of the pool may exit after the static objects are destroyed
+ * @return The registry
+ */
+static counter_registry &registry()
+{
+    static counter_registry *instance = new counter_registry();
+    return *instance;
+}
+
+/**
+ * @brief Registers the counters of a thread when the thread first counts an operation, and keeps their values when the
+ *        thread exits
+ */
+class thread_registration
+{
+public:
+    thread_registration()
+    {
+        lock_guard<mutex> guard(registry().lock);
+        registry().threads.push_back(&counters);
+    }
+
+    ~thread_registration()
+    {
+        counter_registry &counters_of_threads = registry();
+        lock_guard<mutex> guard(counters_of_threads.lock);
+        for (uint64_t op = 0; op < big_int_operation_count; op++)
+        {
+            big_int_operation_stats &retired = counters_of_threads.retired.operations[op];
+            retired.count += counters.values[op][count_index].load(memory_order_relaxed);
+            retired.nanoseconds += counters.values[op][nanoseconds_index].load(memory_order_relaxed);
+            retired.allocations += counters.values[op][allocations_index].load(memory_order_relaxed);
+            retired.allocated_bytes += counters.values[op][bytes_index].load(memory_order_relaxed);
+            for (uint64_t bucket = 0; bucket < big_int_size_buckets; bucket++)
+            {
+                retired.sizes[bucket] += counters.values[op][sizes_index + bucket].load(memory_order_relaxed);
+            }
+        }
+        vector<thread_counters *> &threads = counters_of_threads.threads;
+        threads.erase(find(threads.begin(), threads.end(), &counters));
+    }
+
+    thread_counters counters;
+};
+
+static thread_local thread_registration registration;
+
+// Number of operations being counted on the thread (the outer one and those it calls), only the outermost is counted
+static thread_local uint64_t operation_depth = 0;
+
+// Memory allocated on the thread while an operation is counted, these are trivial so operator new can use them
+static thread_local uint64_t thread_allocations = 0;
+static thread_local uint64_t thread_bytes = 0;
+
+/**
+ * @brief Adds to a counter of the thread, only the thread writes it thus no atomic addition is needed
+ * @param counter The counter
+ * @param value The value to add
+ */
+static void add_counter(atomic<uint64_t> &counter, const uint64_t &value)
+{
+    counter.store(counter.load(memory_order_relaxed) + value, memory_order_relaxed);
+}
+
+/**
+ * @brief Gets the time of a steady clock
+ * @return The time in nanoseconds
+ */
+static uint64_t now_nanoseconds()
+{
+    return (uint64_t)chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/**
+ * @brief Adds the counters of every thread, the lock of the registry must be held
+ * @param counters_of_threads The registry
+ * @return The total of the counters since the program started
+ */
+static big_int_stats total_counters(counter_registry &counters_of_threads)
+{
+    big_int_stats total = counters_of_threads.retired;
+    for (const thread_counters *thread : counters_of_threads.threads)
+    {
+        for (uint64_t op = 0; op < big_int_operation_count; op++)
+        {
+            big_int_operation_stats &operation = total.operations[op];
+            operation.count += thread->values[op][count_index].load(memory_order_relaxed);
+            operation.nanoseconds += thread->values[op][nanoseconds_index].load(memory_order_relaxed);
+            operation.allocations += thread->values[op][allocations_index].load(memory_order_relaxed);
+            operation.allocated_bytes += thread->values[op][bytes_index].load(memory_order_relaxed);
+            for (uint64_t bucket = 0; bucket < big_int_size_buckets; bucket++)
+            {
+                operation.sizes[bucket] += thread->values[op][sizes_index + bucket].load(memory_order_relaxed);
+            }
+        }
+    }
+    return total;
+}
+
+/******************************* Allocation Counting ******************************/
+#ifdef BIG_INT_INSTRUMENT
+void *operator new(size_t size)
+{
+    if (operation_depth > 0)
+    {
+        thread_allocations++;
+        thread_bytes += size;
+    }
+    void *memory = malloc(size == 0 ? 1 : size);
+    if (memory == nullptr)
+    {
+        throw bad_alloc();
+    }
+    return memory;
+}
+
+void operator delete(void *memory) noexcept
+{
+    free(memory);
+}
+
+void operator delete(void *memory, size_t) noexcept
+{
+    free(memory);
+}
+#endif
+
+/******************************* Counting Operations ******************************/
+big_int_operation_scope::big_int_operation_scope(const big_int_operation &counted_operation, const uint64_t &operand_size)
+    : operation(counted_operation), size(operand_size), outermost(operation_depth == 0)
+{
+    operation_depth++;
+    if (outermost)
+    {
+        start_allocations = thread_allocations;
+        start_bytes = thread_bytes;
+        start_nanoseconds = now_nanoseconds();
+    }
+}
+
+big_int_operation_scope::~big_int_operation_scope()
+{
+    if (!outermost)
+    {
+        operation_depth--;
+        return;
+    }
+    uint64_t nanoseconds = now_nanoseconds() - start_nanoseconds;
+    uint64_t allocations = thread_allocations - start_allocations;
+    uint64_t bytes = thread_bytes - start_bytes;
+
+    // The counters are only registered here, their own allocations are not part of the operation
+    operation_depth--;
+    array<atomic<uint64_t>, counters_per_operation> &counters = registration.counters.values[(uint64_t)operation];
+    add_counter(counters[count_index], 1);
+    add_counter(counters[nanoseconds_index], nanoseconds);
+    add_counter(counters[allocations_index], allocations);
+    add_counter(counters[bytes_index], bytes);
+    add_counter(counters[sizes_index + (size == 0 ? 0 : (uint64_t)bit_width(size) - 1)], 1);
+}
+
+/******************************* Snapshots ******************************/
+const big_int_operation_stats &big_int_stats::operator[](const big_int_operation &operation) const
+{
+    return operations[(uint64_t)operation];
+}
+
+bool big_int_instrumented()
+{
+#ifdef BIG_INT_INSTRUMENT
+    return true;
+#else
+    return false;
+#endif
+}
+
+big_int_stats big_int_stats_snapshot()
+{
+    counter_registry &counters_of_threads = registry();
+    lock_guard<mutex> guard(counters_of_threads.lock);
+    big_int_stats total = total_counters(counters_of_threads);
+    for (uint64_t op = 0; op < big_int_operation_count; op++)
+    {
+        big_int_operation_stats &operation = total.operations[op];
+        const big_int_operation_stats &reset = counters_of_threads.reset_point.operations[op];
+        operation.count -= reset.count;
+        operation.nanoseconds -= reset.nanoseconds;
+        operation.allocations -= reset.allocations;
+        operation.allocated_bytes -= reset.allocated_bytes;
+        for (uint64_t bucket = 0; bucket < big_int_size_buckets; bucket++)
+        {
+            operation.sizes[bucket] -= reset.sizes[bucket];
+        }
+    }
+    return total;
+}
+
+void reset_big_int_stats()
+{
+    counter_registry &counters_of_threads = registry();
+    lock_guard<mutex> guard(counters_of_threads.lock);
+    counters_of_threads.reset_point = total_counters(counters_of_threads);
+}
+
+/******************************* Writing ******************************/
+string big_int_operation_name(const big_int_operation &operation)
+{
+    static const char *names[big_int_operation_count] = {"add", "multiply", "divide", "to_string", "from_string"};
+    return names[(uint64_t)operation];
+}
+
+void write_stats_text(ostream &out, const big_int_stats &stats)
+{
+    // The alignment and precision are set for the table only, the stream is given back as it was
+    ios_base::fmtflags flags = out.flags();
+    streamsize precision = out.precision();
+
+    out << left << setw(14) << "operation" << right << setw(14) << "count" << setw(16) << "time (ms)" << setw(14)
+        << "allocations" << setw(16) << "bytes" << "\n";
+    for (uint64_t op = 0; op < big_int_operation_count; op++)
+    {
+        const big_int_operation_stats &operation = stats.operations[op];
+        out << left << setw(14) << big_int_operation_name((big_int_operation)op) << right << setw(14) << operation.count
+            << setw(16) << fixed << setprecision(3) << (double)operation.nanoseconds / 1e6 << setw(14)
+            << operation.allocations << setw(16) << operation.allocated_bytes << "\n";
+
+        // One line per operand size that occurred
+        for (uint64_t bucket = 0; bucket < big_int_size_buckets; bucket++)
+        {
+            if (operation.sizes[bucket] != 0)
+            {
+                uint64_t low = (uint64_t)1 << bucket;
+                out << setw(14) << low << " - " << setw(10) << (low - 1) * 2 + 1 << " coefficients: " << operation.sizes[bucket]
+                    << "\n";
+            }
+        }
+    }
+    out.flags(flags);
+    out.precision(precision);
+}
+
+void write_stats_json(ostream &out, const big_int_stats &stats)
+{
+    out << "{\"instrumented\": " << (big_int_instrumented() ? "true" : "false") << ", \"operations\": {";
+    for (uint64_t op = 0; op < big_int_operation_count; op++)
+    {
+        const big_int_operation_stats &operation = stats.operations[op];
+        out << (op == 0 ? "" : ", ") << "\"" << big_int_operation_name((big_int_operation)op) << "\": {\"count\": "
+            << operation.count << ", \"nanoseconds\": " << operation.nanoseconds << ", \"allocations\": "
+            << operation.allocations << ", \"allocated_bytes\": " << operation.allocated_bytes << ", \"sizes\": {";
+
+        // The sizes that occurred, keyed by the smallest number of coefficients of their bucket
+        bool first = true;
+        for (uint64_t bucket = 0; bucket < big_int_size_buckets; bucket++)
+        {
+            if (operation.sizes[bucket] != 0)
+            {
+                out << (first ? "" : ", ") << "\"" << ((uint64_t)1 << bucket) << "\": " << operation.sizes[bucket];
+                first = false;
+            }
+        }
+        out << "}}";
+    }
+    out << "}}\n";
+}
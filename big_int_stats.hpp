@@ -0,0 +1,152 @@
+#pragma once
+/**
+ * @file big_int_stats.hpp
+ * @author Gabrielle Ching-Johnson
+ * @brief Header file for the counters of the big_int operations, compiled in with the CMake option BIG_INT_INSTRUMENT
+ * @version 0.3
+ * @date Oct 18, 2026
+ */
+
+#include <iostream>
+#include <array>
+#include <string>
+#include <cstdint>
+using namespace std;
+
+/*
+ * When the library is built with BIG_INT_INSTRUMENT defined (the CMake option -DBIG_INT_INSTRUMENT=ON) every addition
+ * or subtraction, multiplication, division and conversion to or from a string is counted with the size of its largest
+ * operand, its time and the memory it allocates. Otherwise the counters are never updated and cost nothing.
+ *
+ * Each thread updates its own counters without locking; a snapshot sums the counters of every thread. Only the
+ * outermost operation is counted, thus the multiplications done by a division are part of the division. Operations
+ * run on the threads of the pool (see thread_pool.hpp) are counted on those threads.
+ */
+
+/**
+ * @brief The kinds of operations that are counted
+ */
+enum class big_int_operation
+{
+    ADD,         // + and - (any sum of big integers)
+    MULTIPLY,    // * and the multiply accumulate functions
+    DIVIDE,      // /
+    TO_STRING,   // print_base10, to_string, to_chars and the streaming of digits
+    FROM_STRING, // the string constructor, from_string and from_chars
+};
+
+// Number of kinds of operations
+constexpr uint64_t big_int_operation_count = 5;
+
+// Number of buckets of the operand sizes, bucket k counts operands of 2^k to 2^(k + 1) - 1 coefficients
+constexpr uint64_t big_int_size_buckets = 64;
+
+/**
+ * @brief The counters of one kind of operation
+ */
+struct big_int_operation_stats
+{
+    // Number of operations
+    uint64_t count = 0;
+
+    // Total time of the operations in nanoseconds
+    uint64_t nanoseconds = 0;
+
+    // Number of memory allocations during the operations and their total size in bytes
+    uint64_t allocations = 0;
+    uint64_t allocated_bytes = 0;
+
+    // Histogram of the number of coefficients of the largest operand
+    array<uint64_t, big_int_size_buckets> sizes{};
+};
+
+/**
+ * @brief The counters of every kind of operation
+ */
+struct big_int_stats
+{
+    // The counters of each kind of operation, indexed by big_int_operation
+    array<big_int_operation_stats, big_int_operation_count> operations{};
+
+    /**
+     * @brief Gets the counters of a kind of operation
+     * @param operation The kind of operation
+     * @return The counters
+     */
+    const big_int_operation_stats &operator[](const big_int_operation &operation) const;
+};
+
+/**
+ * @brief Checks if the library counts the operations
+ * @return True if the library was built with BIG_INT_INSTRUMENT defined
+ */
+bool big_int_instrumented();
+
+/**
+ * @brief Gets the counters of every thread added together, since the last reset
+ * @return The counters
+ */
+big_int_stats big_int_stats_snapshot();
+
+/**
+ * @brief Starts counting from zero, the counters of the threads are kept and later snapshots subtract their values
+ */
+void reset_big_int_stats();
+
+/**
+ * @brief Gets the name of a kind of operation
+ * @param operation The kind of operation
+ * @return The name in lower case (ie "multiply")
+ */
+string big_int_operation_name(const big_int_operation &operation);
+
+/**
+ * @brief Writes the counters as a table, one line per kind of operation and one per operand size
+ * @param out The stream to write to
+ * @param stats The counters
+ */
+void write_stats_text(ostream &out, const big_int_stats &stats);
+
+/**
+ * @brief Writes the counters in JSON
+ * @param out The stream to write to
+ * @param stats The counters
+ */
+void write_stats_json(ostream &out, const big_int_stats &stats);
+
+/**
+ * @brief Counts an operation from its construction to its destruction, used by big_int.cpp when BIG_INT_INSTRUMENT is
+ *        defined
+ * @details Nothing is counted if an operation is already being counted on the thread
+ */
+class big_int_operation_scope
+{
+public:
+    /**
+     * @brief Starts counting an operation
+     * @param operation The kind of operation
+     * @param size The number of coefficients of the largest operand
+     */
+    big_int_operation_scope(const big_int_operation &operation, const uint64_t &size);
+
+    big_int_operation_scope(const big_int_operation_scope &) = delete;
+    big_int_operation_scope &operator=(const big_int_operation_scope &) = delete;
+
+    /**
+     * @brief Adds the operation to the counters of the thread
+     */
+    ~big_int_operation_scope();
+
+private:
+    // The kind of operation and the size of its largest operand
+    big_int_operation operation;
+    uint64_t size;
+
+    // False if an outer operation is counted instead
+    bool outermost;
+
+    // The clock and allocation counts when the operation started
+    uint64_t start_nanoseconds = 0;
+    uint64_t start_allocations = 0;
+    uint64_t start_bytes = 0;
+};
@@ -8,17 +8,32 @@
 
 #include <iostream>
 #include <vector>
+#include <algorithm>
 #include <fstream>
 #include <string>
 #include <filesystem>
 #include <sstream>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
 #include "big_int.hpp"
+#include "big_int_accumulator.hpp"
+#include "big_int_batch.hpp"
+#include "big_int_combinatorics.hpp"
+#include "fixed_big_int.hpp"
+#include "shared_big_int.hpp"
+#include "big_int_binary.hpp"
+#include "big_int_stats.hpp"
+#include "big_int_verify.hpp"
+#include "big_int_random.hpp"
+#include "big_int_intern.hpp"
+#include "thread_pool.hpp"
 using namespace std;
 
-uint8_t passed_counter = 0;
-uint8_t failed_counter = 0;
-uint8_t total_passed = 0;
-uint8_t total_failed = 0;
+uint64_t passed_counter = 0;
+uint64_t failed_counter = 0;
+uint64_t total_passed = 0;
+uint64_t total_failed = 0;
 
 /**
  * @brief Checks if each unit test passes or fails and writes output to log file
@@ -85,6 +100,14 @@ void check_other_constructors(ofstream &file)
     file << "Copy Constructor check ...";
     big_int to_copy(12345678910);
     check(to_copy.at(0) == 3755744318 && to_copy.at(1) == 2 && to_copy.coefficient_size() == 2, file);
+
+    file << "Move Constructor check, the moved from big integer is zero and can still be used ...";
+    big_int moved(std::move(to_copy));
+    check(moved.at(1) == 2 && "+0" == print_base10(to_copy) && to_copy == big_int() && to_copy + 1 == big_int(1), file);
+
+    file << "Move Assignment check, the moved from big integer has the old value ...";
+    to_copy = std::move(moved);
+    check(to_copy.at(1) == 2 && "+0" == print_base10(moved) && moved - 1 == big_int(-1), file);
 }
 
 /**
@@ -264,6 +287,42 @@ void check_division(const vector<big_int> &numbers, const vector<string> &quotie
     file << "Checking division for dividend > divisor value ...";
     check("-1921739" == print_base10(pos_2 / neg_1), file);
 
+    // Dividends of 3 and 4 blocks of the divisor, with coefficients from a linear congruential generator
+    uint32_t seed = 987654321;
+    vector<uint32_t> digits_a(250);
+    vector<uint32_t> digits_b(70);
+    for (uint32_t &digit : digits_a)
+    {
+        seed = seed * 1664525 + 1013904223;
+        digit = seed;
+    }
+    for (uint32_t &digit : digits_b)
+    {
+        seed = seed * 1664525 + 1013904223;
+        digit = seed;
+    }
+    big_int int_a(digits_a);
+    big_int int_b(digits_b);
+
+    uint64_t original_division = division_threshold();
+    set_division_threshold(UINT32_MAX);
+    big_int long_quotient = int_a / int_b;
+
+    file << "Checking the long division quotient leaves a remainder less than the divisor ...";
+    big_int remainder = int_a - long_quotient * int_b;
+    check(remainder.get_sign() == sign::POSITIVE && remainder < int_b, file);
+
+    file << "Checking the Barrett quotient matches the long division quotient ...";
+    set_division_threshold(8);
+    check(int_a / int_b == long_quotient, file);
+
+    file << "Checking the Barrett quotient of a negative dividend ...";
+    check(-int_a / int_b == -long_quotient, file);
+
+    file << "Checking the quotient of a divisor above the threshold that fits in one coefficient ...";
+    big_int short_dividend = int_b * big_int(4000000000) + big_int(5);
+    check("+4000000000" == print_base10(short_dividend / int_b), file);
+
     file << "\nRandom Big Integers Tests:\n";
 
     file << "Checking division by zero exception thrown ...";
@@ -292,6 +351,12 @@ void check_division(const vector<big_int> &numbers, const vector<string> &quotie
 
     file << "Checking division of the 1st negative and positive random integer ...";
     check(quotients[2] == print_base10(numbers[2] / numbers[0]), file);
+
+    file << "Checking the Barrett quotient of two positive integers ...";
+    set_division_threshold(1);
+    check(quotients[0] == print_base10(numbers[0] / numbers[1]), file);
+
+    set_division_threshold(original_division);
 }
 
 /**
@@ -348,194 +413,1556 @@ void check_not_equals_and_equals(const vector<big_int> &numbers, ofstream &file)
 }
 
 /**
- * @brief Read input values into desired vector and check for invalid input
- * @param value_vec The vector to store the values 
- * @param line A string containing the values to store seperated by a comma
- * @param line_num Integer indicating which line from input file the string came from
+ * @brief Sums two big integers taken by value, the expression returned holds them as they are moved into it
+ * @param int_a The first big integer
+ * @param int_b The second big integer
+ * @return The expression of the sum, not evaluated yet
  */
-void read_values(vector<string> &value_vec, const string &line, const uint8_t &line_num)
+auto sum_of(big_int int_a, big_int int_b)
 {
-    string value;
-    istringstream line_stream(line);
-    // input each value in line to vector
-    while (getline(line_stream, value, ','))
+    return std::move(int_a) + std::move(int_b);
+}
+
+/**
+ * @brief Test the deferred evaluation of expressions and the compound assignment operators for big integers
+ * @param numbers A vector of 4 big integers, the 1st two are positive and the 2nd two are negative
+ * @param file The log file to print results to
+ */
+void check_expressions(const vector<big_int> &numbers, ofstream &file)
+{
+    big_int int_a("123456789012345678901234567890");
+    big_int int_b("-987654321098765432109876543210");
+    big_int int_c("18446744073709551616");
+    big_int int_d(4294967295);
+    big_int int_e(-5);
+
+    file << "Hard Coded tests:\n";
+    file << "Checking a fused sum of products a * b + c * d - e ...";
+    big_int fused = int_a * int_b + int_c * int_d - int_e;
+    check("-121932631137021795226185032733543695169741646207591429128175" == print_base10(fused), file);
+
+    file << "Checking += of a product accumulated into a big integer ...";
+    big_int accumulator(int_c);
+    accumulator += int_a * int_b;
+    check("-121932631137021795226185032733622923332219017057037553975284" == print_base10(accumulator), file);
+
+    file << "Checking -= of the same product gives back the original value ...";
+    accumulator -= int_a * int_b;
+    check(accumulator == int_c, file);
+
+    file << "Checking an expression that refers to the big integer it is assigned to ...";
+    big_int alias(int_c);
+    alias = alias * int_d + alias;
+    check("+79228162514264337593543950336" == print_base10(alias), file);
+
+    file << "Checking the accessors of big_int evaluate an expression ...";
+    bool accessors = (int_a + int_b).get_sign() == sign::NEGATIVE && (int_c * int_d).coefficient_size() == 3 && (int_c - int_d).at(0) == 1;
+    check(accessors && big_int(int_a * int_e).to_string(16) == (int_a * int_e).to_string(16), file);
+
+    file << "Checking a conditional of two expressions converted to a big integer ...";
+    big_int chosen = int_e < int_d ? big_int(int_a + int_c) : int_a * int_c;
+    check(chosen == int_a + int_c, file);
+
+    file << "Checking an expression returned by a function holds the big integers it was given ...";
+    big_int returned = sum_of(big_int(int_a), int_c) * int_e;
+    check("-617283945153962114874720597530" == print_base10(returned), file);
+
+    file << "Checking an expression of temporaries can be stored in an auto variable ...";
+    auto stored = -5_bi * (big_int(int_a) + big_int(int_c));
+    check("-617283945153962114874720597530" == print_base10(big_int(stored)), file);
+
+    file << "\nRandom Big Integers Tests:\n";
+    file << "Checking a difference of equal values is a positive zero ...";
+    check("+0" == print_base10(numbers[2] - numbers[2]), file);
+
+    file << "Checking a chain of sums matches the sum of the sums evaluated one at a time ...";
+    big_int first_sum = numbers[0] + numbers[2];
+    big_int second_sum = numbers[1] - numbers[3];
+    check(numbers[0] + numbers[2] + numbers[1] - numbers[3] == first_sum + second_sum, file);
+}
+
+/**
+ * @brief Test the fused multiply accumulate functions for big integers
+ * @param numbers A vector of 4 big integers, the 1st two are positive and the 2nd two are negative
+ * @param products A vector of strings containing the solutions to the multiplication of big integers
+ * @param file The log file to print results to
+ */
+void check_multiply_accumulate(const vector<big_int> &numbers, const vector<string> &products, ofstream &file)
+{
+    file << "Hard Coded tests:\n";
+    file << "Checking addmul_1 of a single 32 bit multiplier ...";
+    big_int accumulator(-1);
+    addmul_1(accumulator, big_int("18446744073709551616"), 4294967295);
+    check("+79228162495817593519834398719" == print_base10(accumulator), file);
+
+    file << "Checking submul_1 changes the sign of the accumulator ...";
+    submul_1(accumulator, big_int("18446744073709551616"), 4294967295);
+    submul_1(accumulator, big_int(1), 1);
+    check("-2" == print_base10(accumulator), file);
+
+    file << "\nRandom Big Integers Tests:\n";
+    file << "Checking addmul into zero gives the product of two positive numbers ...";
+    big_int zero;
+    addmul(zero, numbers[0], numbers[1]);
+    check(products[0] == print_base10(zero), file);
+
+    file << "Checking submul of the same product gives back zero ...";
+    submul(zero, numbers[0], numbers[1]);
+    check("+0" == print_base10(zero), file);
+
+    file << "Checking addmul of a negative product into a positive accumulator ...";
+    big_int sum(numbers[1]);
+    addmul(sum, numbers[0], numbers[2]);
+    check(numbers[1] + numbers[0] * numbers[2] == sum, file);
+}
+
+/**
+ * @brief Test the carry-save accumulator for summing many big integers
+ * @param numbers A vector of 4 big integers, the 1st two are positive and the 2nd two are negative
+ * @param sum_vals A vector of strings containing the solutions to the summation of big integers
+ * @param file The log file to print results to
+ */
+void check_accumulator(const vector<big_int> &numbers, const vector<string> &sum_vals, ofstream &file)
+{
+    file << "Hard Coded tests:\n";
+    file << "Checking an empty accumulator has the value zero ...";
+    big_int_accumulator empty;
+    check("+0" == print_base10(empty.value()), file);
+
+    file << "Checking a carry is propagated across many coefficients ...";
+    big_int_accumulator carries;
+    for (uint64_t i = 0; i < 1000; i++)
     {
-        value_vec.push_back(value);
+        carries += big_int("18446744073709551615");
     }
+    check("+18446744073709551615000" == print_base10(carries.value()), file);
 
-    // Check number of input values per line
-    uint64_t size = value_vec.size();
-    if (line_num == 1 || line_num == 2 || line_num == 6)
+    file << "\nRandom Big Integers Tests:\n";
+    file << "Checking the sum of two positive numbers ...";
+    big_int_accumulator positive;
+    positive += numbers[0];
+    positive += numbers[1];
+    check(sum_vals[0] == print_base10(positive.value()), file);
+
+    file << "Checking the sum of a positive and a negative number ...";
+    big_int_accumulator mixed;
+    mixed += numbers[0];
+    mixed += numbers[2];
+    check(sum_vals[2] == print_base10(mixed.value()), file);
+
+    file << "Checking subtracting every number added gives back zero ...";
+    big_int_accumulator total;
+    for (const big_int &integer : numbers)
     {
-        if (size != 4)
-        {
-            throw invalid_argument("Invalid number of integers in input file, expected 4 but got " + to_string(size) + " in line " + to_string(line_num) + "\n");
-        }
+        total += integer;
     }
-    else
+    for (const big_int &integer : numbers)
     {
-        if (size != 3)
-        {
-            throw invalid_argument("Invalid number of integers in input file, expected 3 but got " + to_string(size) + " in line " + to_string(line_num) + "\n");
-        }
+        total -= integer;
     }
+    check("+0" == print_base10(total.value()), file);
+}
 
-    // Check all values are numbers in the vector or boolean for 6th line
-    for (const string &integers : value_vec)
+/**
+ * @brief Test the Karatsuba and parallel multiplication against the basic multiplication for big integers
+ * @param numbers A vector of 4 big integers, the 1st two are positive and the 2nd two are negative
+ * @param products A vector of strings containing the solutions to the multiplication of big integers
+ * @param file The log file to print results to
+ */
+void check_large_multiplication(const vector<big_int> &numbers, const vector<string> &products, ofstream &file)
+{
+    // Coefficients for two big integers with 300 and 700 digits in base 2^32
+    vector<uint32_t> digits_a(300);
+    vector<uint32_t> digits_b(700);
+    uint32_t seed = 12345;
+    for (uint32_t &digit : digits_a)
     {
-        if (line_num == 6)
-        {
-            if (integers != "true" && integers != "false")
-            {
-                throw invalid_argument("Invalid bool provided in line 6 of the input file expected either true or false but got " + integers + "\n");
-            }
-        }
-        else
-        {
-            string::const_iterator start = integers.begin();
-            // Check 1st character if + or - sign and move iterator start to next char if sign is there and string is not a single char
-            if (integers[0] == '+' || integers[0] == '-')
-            {
-                if (integers.size() != 1) // only update iterator if integer is not a single character
-                    start++;
-            }
-            // Check if line contains results and if so throw invalid argument as failed above condition but must contain a positive or negative sign
-            else if (line_num != 1)
-            {
-                throw invalid_argument("Invalid integer provided in line " + to_string(line_num) + " of the input file, all integers must contain a + or - sign\n");
-            }
-            
-            // Check rest of the values that they are digits
-            if (!all_of(start, integers.end(), ::isdigit))
-            {
-                throw invalid_argument("Invalid input provided in line " + to_string(line_num) + " of the input file, expected an integer but received: " + integers + "\n");
-            }
-        }
+        seed = seed * 1664525 + 1013904223;
+        digit = seed;
     }
+    for (uint32_t &digit : digits_b)
+    {
+        seed = seed * 1664525 + 1013904223;
+        digit = seed;
+    }
+    big_int int_a(digits_a);
+    big_int int_b(digits_b);
+    big_int int_c = -int_b;
+
+    uint64_t original_karatsuba = karatsuba_threshold();
+    uint64_t original_parallel = parallel_multiply_threshold();
+
+    set_karatsuba_threshold(UINT32_MAX);
+    big_int basic = int_a * int_b;
+    big_int basic_square = int_a * int_a;
+
+    file << "Hard Coded tests:\n";
+    file << "Checking the Karatsuba product matches the basic product ...";
+    set_karatsuba_threshold(8);
+    check(int_a * int_b == basic, file);
+
+    file << "Checking the Karatsuba square matches the basic square ...";
+    check(int_a * int_a == basic_square, file);
+
+    file << "Checking a Karatsuba product added to a negative accumulator ...";
+    big_int accumulator(int_c);
+    addmul(accumulator, int_a, int_b);
+    check(accumulator == basic - int_b, file);
+
+    file << "Checking the parallel product on 4 threads matches the basic product ...";
+    set_big_int_threads(4);
+    set_parallel_multiply_threshold(16);
+    check(int_a * int_b == basic, file);
+
+    file << "\nRandom Big Integers Tests:\n";
+    file << "Checking the parallel product of two positive numbers ...";
+    check(products[0] == print_base10(numbers[0] * numbers[1]), file);
+
+    file << "Checking the parallel product of a positive and negative number ...";
+    check(products[2] == print_base10(numbers[0] * numbers[2]), file);
+
+    set_big_int_threads(1);
+    set_karatsuba_threshold(original_karatsuba);
+    set_parallel_multiply_threshold(original_parallel);
 }
 
-int main()
+/**
+ * @brief Test the divide and conquer and parallel conversion of big integers to base 10 strings
+ * @param numbers A vector of strings of 4 big integers, the 1st two are positive and the 2nd two are negative
+ * @param products A vector of strings containing the solutions to the multiplication of big integers
+ * @param file The log file to print results to
+ */
+void check_large_print(const vector<string> &numbers, const vector<string> &products, ofstream &file)
 {
-    /***************************************** Read Input File ******************************************/
-    string input_file = "test_input.txt";
-    ifstream operations_input(input_file);
-    if (!operations_input.is_open())
+    // A big integer with 500 digits in base 2^32
+    vector<uint32_t> digits(500);
+    uint32_t seed = 54321;
+    for (uint32_t &digit : digits)
     {
-        cout << "Error opening input file "
-             << "test_input.txt\n";
-        return -1;
+        seed = seed * 1664525 + 1013904223;
+        digit = seed;
     }
+    big_int large(digits);
+    big_int power_of_ten("1000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000");
 
-    string input_line;
-    vector<string> numbers;      // 4 big_int strings
-    vector<big_int> big_numbers; // the 4 big integers as type big_int
-    vector<string> sums;         // sums of the integers
-    vector<string> diffs;        // differences of the integers
-    vector<string> products;     // products of the integers
-    vector<string> quotients;    // quotients of the integers
-    vector<string> greater_less; // boolean for < and >
+    uint64_t original_conversion = conversion_threshold();
+    uint64_t original_parallel = parallel_conversion_threshold();
 
-    // Read 6 lines from input
-    try
-    {
-        uint8_t line_counter = 0;
-        for (uint8_t i = 1; getline(operations_input, input_line); i++)
-        {
-            switch (i)
-            {
-            case 1:
-                read_values(numbers, input_line, i);
-                break;
-            case 2:
-                read_values(sums, input_line, i);
-                break;
-            case 3:
-                read_values(diffs, input_line, i);
-                break;
-            case 4:
-                read_values(products, input_line, i);
-                break;
-            case 5:
-                read_values(quotients, input_line, i);
-                break;
-            case 6:
-                read_values(greater_less, input_line, i);
-                break;
-            default:
-                break;
-            }
-            line_counter++;
-        }
+    set_conversion_threshold(UINT32_MAX);
+    string basic = print_base10(large);
 
-        if (line_counter != 6)
-        {
-            throw invalid_argument("Invalid number of lines read, expected 6 lines but only read " + to_string(line_counter) + "\n");
-        }
-    }
-    catch (invalid_argument &exception)
-    {
-        cout << exception.what();
-        return -1;
-    }
+    file << "Hard Coded tests:\n";
+    file << "Checking the divide and conquer conversion matches repeated division ...";
+    set_conversion_threshold(2);
+    check(basic == print_base10(large), file);
 
-    // Close input file
-    operations_input.close();
+    file << "Checking the divide and conquer conversion of a power of ten keeps its zeros ...";
+    check("+1000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000" == print_base10(power_of_ten), file);
 
-    // update the big_int vector with the four random values
-    for (const string &integers : numbers)
+    file << "Checking the parallel conversion on 4 threads matches repeated division ...";
+    set_big_int_threads(4);
+    set_parallel_conversion_threshold(4);
+    check(basic == print_base10(large), file);
+
+    file << "\nRandom Big Integers Tests:\n";
+    file << "Checking the parallel conversion of a negative number ...";
+    check(numbers[2] == print_base10(big_int(numbers[2])), file);
+
+    file << "Checking the parallel conversion of the product of two positive numbers ...";
+    check(products[0] == print_base10(big_int(numbers[0]) * big_int(numbers[1])), file);
+
+    set_big_int_threads(1);
+    set_conversion_threshold(original_conversion);
+    set_parallel_conversion_threshold(original_parallel);
+}
+
+/**
+ * @brief Test the divide and conquer and parallel conversion of base 10 strings to big integers
+ * @param numbers A vector of strings of 4 big integers, the 1st two are positive and the 2nd two are negative
+ * @param products A vector of strings containing the solutions to the multiplication of big integers
+ * @param file The log file to print results to
+ */
+void check_large_parse(const vector<string> &numbers, const vector<string> &products, ofstream &file)
+{
+    // A string of 3000 digits, whose length is not a multiple of the 9 digits read at a time
+    string digits = "-";
+    uint32_t seed = 12345;
+    for (uint64_t i = 0; i < 3000; i++)
     {
-        big_numbers.push_back(big_int(integers));
+        seed = seed * 1664525 + 1013904223;
+        digits += (char)('0' + (seed >> 16) % 10);
     }
+    digits[1] = '7';
 
-    /***************************************** Open Log File ********************************************/
-    /* Referenced the following for filesystem class:
-           https://en.cppreference.com/w/cpp/filesystem/path
-           https://en.cppreference.com/w/cpp/filesystem/exists
-    */
+    uint64_t original_conversion = conversion_threshold();
+    uint64_t original_parallel = parallel_conversion_threshold();
 
-    // Check if log file name already exists, if so keep on appending a number to end of file name
-    string log_file_name = "log_file_big_int_tests";
-    string log_file_type = ".txt";
-    string log_file = log_file_name + log_file_type;
-    string file_path = log_file;
-    filesystem::path out_path(file_path);
-    int file_num = 1;
-    string original_log_file = log_file;
-    while (filesystem::exists(out_path))
+    set_conversion_threshold(UINT32_MAX);
+    big_int basic(digits);
+
+    file << "Hard Coded tests:\n";
+    file << "Checking the divide and conquer parsing matches reading one chunk of digits at a time ...";
+    set_conversion_threshold(2);
+    big_int divided(digits);
+    check(basic == divided && digits == print_base10(divided), file);
+
+    file << "Checking the divide and conquer parsing of a power of ten keeps its zeros ...";
+    string power = "+1" + string(2000, '0');
+    check(power == print_base10(big_int(power)), file);
+
+    file << "Checking the parallel parsing on 4 threads matches reading one chunk of digits at a time ...";
+    set_big_int_threads(4);
+    set_parallel_conversion_threshold(4);
+    check(basic == big_int(digits), file);
+
+    file << "Checking the parallel parsing throws an exception for an invalid digit in the low digits ...";
+    string invalid = digits;
+    invalid[2900] = 'j';
+    try
     {
-        log_file = log_file_name + "_" + to_string(file_num) + log_file_type;
-        file_path = log_file;
-        out_path.replace_filename(file_path);
-        file_num += 1;
+        big_int except(invalid);
+        check(false, file);
     }
-
-    // Open log file and check to ensure it opens
-    ofstream log(file_path, ios::app);
-    if (!log.is_open())
+    catch (const invalid_string_integer &e)
     {
-        cout << "Error opening file " << log_file << "!\n";
-        return -1;
+        check(true, file);
     }
 
-    // Inform file writing solution to
-    if (original_log_file != log_file)
-        cout << "Original Log File " << original_log_file << " already exists and thus writing test logs to file: " << log_file << "\n";
-    else
-        cout << "Writing test logs to " << log_file << "\n";
+    file << "\nRandom Big Integers Tests:\n";
+    file << "Checking the parallel parsing of a negative number ...";
+    check(numbers[2] == print_base10(big_int(numbers[2])), file);
 
-    /*********************************** Run tests and Write output to log files ****************************************/
-    log << "***********Testing all constructors of the big_int class:***********\n";
-    cout << "Testing Constructors\n";
-    check_other_constructors(log);
-    check_integer_constructor(log);
-    check_string_constructor(log);
-    number_tests_passed(log);
-    update_counters();
+    file << "Checking the parallel parsing of the product of two positive numbers ...";
+    check(big_int(products[0]) == big_int(numbers[0]) * big_int(numbers[1]), file);
 
-    log << "\n***********Testing printing to a string of the big_int class:***********\n";
-    cout << "Testing printing to base 10\n";
-    check_print(numbers, log);
-    number_tests_passed(log);
+    set_big_int_threads(1);
+    set_conversion_threshold(original_conversion);
+    set_parallel_conversion_threshold(original_parallel);
+}
+
+/**
+ * @brief Test the element-wise operations of the big_int_batch class
+ * @param numbers A vector of 4 big integers, the 1st two are positive and the 2nd two are negative
+ * @param sum_vals A vector of strings containing the solutions to the summation of big integers
+ * @param differences A vector of strings containing the solutions to the difference of big integers
+ * @param products A vector of strings containing the solutions to the multiplication of big integers
+ * @param bool_sols A vector of strings containing the solutions to the comparison of big integers
+ * @param file The log file to print results to
+ */
+void check_batch(const vector<big_int> &numbers, const vector<string> &sum_vals, const vector<string> &differences, const vector<string> &products, const vector<string> &bool_sols, ofstream &file)
+{
+    file << "Hard Coded tests:\n";
+    file << "Checking the most negative integer of one coefficient fits in a batch ...";
+    big_int_batch small(2, 1);
+    small.set(0, big_int(-2147483648));
+    check(small.get(0) == big_int(-2147483648) && small.get(1) == big_int(0), file);
+
+    file << "Checking an exception is thrown for an integer wider than the batch ...";
+    try
+    {
+        small.set(1, big_int(2147483648));
+        check(false, file);
+    }
+    catch (const batch_width_overflow &e)
+    {
+        check(true, file);
+    }
+
+    // The pairs of the sums, differences and products of the input file
+    big_int_batch sum_a({numbers[0], numbers[2], numbers[0], numbers[1]});
+    big_int_batch sum_b({numbers[1], numbers[3], numbers[2], numbers[3]});
+    big_int_batch difference_a({numbers[0], numbers[2], numbers[2]});
+    big_int_batch difference_b({numbers[1], numbers[0], numbers[3]});
+    big_int_batch product_a({numbers[0], numbers[2], numbers[0]});
+    big_int_batch product_b({numbers[1], numbers[3], numbers[2]});
+
+    file << "\nRandom Big Integers Tests:\n";
+    file << "Checking the batch addition of the four pairs of random integers ...";
+    vector<big_int> batch_sums = (sum_a + sum_b).to_big_ints();
+    bool correct = true;
+    for (uint64_t i = 0; i < 4; i++)
+    {
+        correct = correct && sum_vals[i] == print_base10(batch_sums[i]);
+    }
+    check(correct, file);
+
+    file << "Checking the batch subtraction of the three pairs of random integers ...";
+    vector<big_int> batch_differences = (difference_a - difference_b).to_big_ints();
+    correct = true;
+    for (uint64_t i = 0; i < 3; i++)
+    {
+        correct = correct && differences[i] == print_base10(batch_differences[i]);
+    }
+    check(correct, file);
+
+    file << "Checking the batch multiplication of the three pairs of random integers ...";
+    vector<big_int> batch_products = (product_a * product_b).to_big_ints();
+    correct = true;
+    for (uint64_t i = 0; i < 3; i++)
+    {
+        correct = correct && products[i] == print_base10(batch_products[i]);
+    }
+    check(correct, file);
+
+    file << "Checking the batch comparison of two positive and two negative random integers ...";
+    bool positive_less;
+    bool negative_less;
+    istringstream(bool_sols[0]) >> boolalpha >> positive_less;
+    istringstream(bool_sols[2]) >> boolalpha >> negative_less;
+    vector<int8_t> order = compare(sum_a, sum_b);
+    check((order[0] == -1) == positive_less && (order[1] == -1) == negative_less && order[2] == 1, file);
+
+    file << "Checking the parallel batch multiplication on 4 threads of 1000 pairs ...";
+    vector<big_int> many_a;
+    vector<big_int> many_b;
+    for (uint64_t i = 0; i < 1000; i++)
+    {
+        many_a.push_back(numbers[i % 4]);
+        many_b.push_back(numbers[(i + 1) % 4]);
+    }
+    set_big_int_threads(4);
+    vector<big_int> many_products = (big_int_batch(many_a) * big_int_batch(many_b)).to_big_ints();
+    set_big_int_threads(1);
+    correct = true;
+    for (uint64_t i = 0; i < 1000; i++)
+    {
+        correct = correct && many_products[i] == big_int(many_a[i] * many_b[i]);
+    }
+    check(correct, file);
+}
+
+/**
+ * @brief Test the product tree, factorial and binomial coefficient functions
+ * @param numbers A vector of 4 big integers, the 1st two are positive and the 2nd two are negative
+ * @param products A vector of strings containing the solutions to the multiplication of big integers
+ * @param file The log file to print results to
+ */
+void check_combinatorics(const vector<big_int> &numbers, const vector<string> &products, ofstream &file)
+{
+    file << "Hard Coded tests:\n";
+    file << "Checking the factorial of 30 ...";
+    check("+265252859812191058636308480000000" == print_base10(factorial(30)), file);
+
+    file << "Checking the factorial of 0 is 1 ...";
+    check(factorial(0) == big_int(1), file);
+
+    file << "Checking the binomial coefficient 100 choose 50 ...";
+    check("+100891344545564193334812497256" == print_base10(binomial(100, 50)), file);
+
+    file << "Checking the binomial coefficient is 0 when more items are chosen than there are ...";
+    check(binomial(5, 7) == big_int(0), file);
+
+    file << "Checking the product of the integers from 1 to 25 matches the factorial of 25 ...";
+    vector<int64_t> integers;
+    for (int64_t i = 1; i <= 25; i++)
+    {
+        integers.push_back(i);
+    }
+    check("+15511210043330985984000000" == print_base10(product(integers)) && factorial(25) == product(integers), file);
+
+    file << "Checking the parallel factorial of 3000 on 4 threads matches the sequential factorial ...";
+    big_int sequential = factorial(3000);
+    set_big_int_threads(4);
+    uint64_t original_parallel = parallel_multiply_threshold();
+    set_parallel_multiply_threshold(8);
+    big_int parallel = factorial(3000);
+    set_parallel_multiply_threshold(original_parallel);
+    set_big_int_threads(1);
+    check(sequential == parallel, file);
+
+    file << "\nRandom Big Integers Tests:\n";
+    file << "Checking the product tree of two positive numbers ...";
+    check(products[0] == print_base10(product(vector<big_int>{numbers[0], numbers[1]})), file);
+
+    file << "Checking the product tree of all four random numbers ...";
+    big_int product_all = big_int(products[0]) * big_int(products[1]);
+    check(product_all == product(numbers), file);
+}
+
+/**
+ * @brief Test the fixed width integers of the fixed_big_int class template
+ * @param numbers A vector of 4 big integers, the 1st two are positive and the 2nd two are negative
+ * @param sum_vals A vector of strings containing the solutions to the summation of big integers
+ * @param differences A vector of strings containing the solutions to the difference of big integers
+ * @param products A vector of strings containing the solutions to the multiplication of big integers
+ * @param file The log file to print results to
+ */
+void check_fixed_width(const vector<big_int> &numbers, const vector<string> &sum_vals, const vector<string> &differences, const vector<string> &products, ofstream &file)
+{
+    // Evaluated by the compiler, the static_assert fails to compile if the operations are wrong
+    constexpr int256 constant = int256(-5) * int256(INT64_MAX) + int256(INT64_MAX) - int256(3);
+    static_assert(constant < int256(0) && -constant == int256(4) * int256(INT64_MAX) + int256(3));
+
+    file << "Hard Coded tests:\n";
+    file << "Checking the compile time arithmetic of 256 bit integers ...";
+    check("-36893488147419103231" == print_base10(constant.to_big_int()), file);
+
+    file << "Checking the addition of 64 bit integers wraps around ...";
+    check(fixed_big_int<64>(INT64_MAX) + fixed_big_int<64>(1) == fixed_big_int<64>(INT64_MIN), file);
+
+    file << "Checking the full product of 64 bit integers does not wrap around ...";
+    check("-85070591730234615847396907784232501249" == print_base10(full_product(fixed_big_int<64>(INT64_MAX), fixed_big_int<64>(-INT64_MAX)).to_big_int()), file);
+
+    file << "Checking an exception is thrown for a big integer wider than the fixed width ...";
+    try
+    {
+        fixed_big_int<64> except(big_int("9223372036854775808"));
+        check(false, file);
+    }
+    catch (const fixed_width_overflow &e)
+    {
+        check(true, file);
+    }
+
+    // The random integers have up to 1024 bits, thus they need one more coefficient for the sign bit
+    fixed_big_int<1056> positive_1(numbers[0]);
+    fixed_big_int<1056> positive_2(numbers[1]);
+    fixed_big_int<1056> negative_1(numbers[2]);
+    fixed_big_int<1056> negative_2(numbers[3]);
+
+    file << "\nRandom Big Integers Tests:\n";
+    file << "Checking the conversion of a negative number to a big_int ...";
+    check(print_base10(numbers[2]) == print_base10(negative_1.to_big_int()), file);
+
+    file << "Checking the addition of two negative numbers ...";
+    check(sum_vals[1] == print_base10((negative_1 + negative_2).to_big_int()), file);
+
+    file << "Checking the subtraction of 1st negative and positive random integers ...";
+    check(differences[1] == print_base10((negative_1 - positive_1).to_big_int()), file);
+
+    file << "Checking the multiplication of the 1st random negative and positive big integer ...";
+    check(products[2] == print_base10(full_product(positive_1, negative_1).to_big_int()), file);
+
+    file << "Checking less than for negative and positive numbers ...";
+    check(negative_1 < positive_1 && !(positive_2 < negative_2) && !(positive_1 < positive_1), file);
+}
+
+/**
+ * @brief Test the constant expressions of big_int and the _bi literal
+ * @param numbers A vector of strings of 4 big integers, the 1st two are positive and the 2nd two are negative
+ * @param products A vector of strings containing the solutions to the multiplication of big integers
+ * @param file The log file to print results to
+ */
+void check_constant_expressions(const vector<string> &numbers, const vector<string> &products, ofstream &file)
+{
+    // Evaluated by the compiler, the static_asserts fail to compile if the operations are wrong
+    static_assert(2_bi * 3_bi - 10_bi == -4_bi);
+    static_assert(0xFFFF'FFFF'FFFF'FFFF_bi + 1_bi == 18446744073709551616_bi);
+    static_assert(big_int(INT64_MIN) < 0b1_bi && 017_bi != 0_bi);
+
+    file << "Hard Coded tests:\n";
+    file << "Checking a decimal literal wider than 64 bits ...";
+    check("+340282366920938463463374607431768211456" == print_base10(340282366920938463463374607431768211456_bi), file);
+
+    file << "Checking a negative hexadecimal literal ...";
+    check("-1208925819614629174706175" == print_base10(-0xFFFF'FFFF'FFFF'FFFF'FFFF_bi), file);
+
+    file << "Checking a literal with leading zeros equals zero ...";
+    check(000_bi == big_int() && (0_bi).coefficient_size() == 1, file);
+
+    file << "Checking the comparison of big integers with a different number of coefficients ...";
+    check(0x1'0000'0000_bi != 1_bi && !(0x1'0000'0000_bi == 1_bi), file);
+
+    // The coefficients of long literals are found by the compiler and copied into the big_ints at runtime
+    big_int positive_1 = 12345678901234567890123456789012345678901234567890_bi;
+    big_int negative_1 = -98765432109876543210987654321098765432109876543210_bi;
+
+    file << "\nRandom Big Integers Tests:\n";
+    file << "Checking a long literal equals the integer read from a string ...";
+    check(positive_1 == big_int("12345678901234567890123456789012345678901234567890") && negative_1 == big_int("-98765432109876543210987654321098765432109876543210"), file);
+
+    file << "Checking the multiplication of two literals ...";
+    check("-1219326311370217952261850327338667885945115073915611949397448712086533622923332237463801111263526900" == print_base10(positive_1 * negative_1), file);
+
+    file << "Checking the multiplication of the 1st random negative and positive big integer ...";
+    check(products[2] == print_base10(big_int(numbers[0]) * big_int(numbers[2])), file);
+}
+
+/**
+ * @brief Test the copy on write big integers of the shared_big_int class
+ * @param numbers A vector of 4 big integers, the 1st two are positive and the 2nd two are negative
+ * @param sum_vals A vector of strings containing the solutions to the summation of big integers
+ * @param products A vector of strings containing the solutions to the multiplication of big integers
+ * @param file The log file to print results to
+ */
+void check_shared(const vector<big_int> &numbers, const vector<string> &sum_vals, const vector<string> &products, ofstream &file)
+{
+    file << "Hard Coded tests:\n";
+    file << "Checking a default shared big integer is a zero that is not shared ...";
+    shared_big_int zero_1;
+    shared_big_int zero_2;
+    check(zero_1.use_count() == 1 && &zero_1.value() != &zero_2.value() && zero_1.value() == big_int(), file);
+
+    file << "Checking a default shared big integer is changed in place without changing the other zeros ...";
+    const big_int *zero_address = &zero_1.value();
+    zero_1 += big_int(5);
+    check(zero_1.value() == big_int(5) && &zero_1.value() == zero_address && zero_2.value() == big_int() && shared_big_int().value() == big_int(), file);
+
+    file << "\nRandom Big Integers Tests:\n";
+    shared_big_int original(numbers[0]);
+    vector<shared_big_int> copies(3, original);
+
+    file << "Checking copies share the coefficients of the big integer ...";
+    check(original.use_count() == 4 && &copies[2].value() == &original.value(), file);
+
+    file << "Checking the negation of a copy only changes that copy ...";
+    copies[0].negate();
+    check(copies[0].value() == -numbers[0] && original.value() == numbers[0] && copies[0].use_count() == 1 && original.use_count() == 3, file);
+
+    file << "Checking the addition of a negative number to a copy ...";
+    copies[1] += numbers[2];
+    check(sum_vals[2] == print_base10(copies[1]) && original.value() == numbers[0], file);
+
+    file << "Checking the multiplication of the 1st random negative and positive big integer is accumulated into a copy ...";
+    copies[2] -= original.value();
+    copies[2] += original.value() * numbers[2];
+    check(products[2] == print_base10(copies[2]) && print_base10(numbers[0]) == print_base10(original), file);
+
+    file << "Checking a shared big integer that is not shared is changed in place ...";
+    const big_int *address = &copies[2].value();
+    copies[2] -= numbers[3];
+    check(address == &copies[2].value(), file);
+}
+
+/**
+ * @brief Test the binary format and the memory mapped views of big integers
+ * @param numbers A vector of 4 big integers, the 1st two are positive and the 2nd two are negative
+ * @param products A vector of strings containing the solutions to the multiplication of big integers
+ * @param file The log file to print results to
+ */
+void check_binary(const vector<big_int> &numbers, const vector<string> &products, ofstream &file)
+{
+    file << "Hard Coded tests:\n";
+    file << "Checking the binary format of -1 ...";
+    stringstream minus_one;
+    write_binary(minus_one, big_int(-1));
+    check(minus_one.str() == string("BINT\x01\0\0\0\x01\0\0\0\0\0\0\0\x01\0\0\0", 20), file);
+
+    file << "Checking an exception is thrown for truncated binary data ...";
+    try
+    {
+        stringstream truncated(minus_one.str().substr(0, 18));
+        read_binary(truncated);
+        check(false, file);
+    }
+    catch (const invalid_binary_integer &e)
+    {
+        check(true, file);
+    }
+
+    file << "Checking an exception is thrown for data that is not in the binary format ...";
+    try
+    {
+        stringstream text("12345678901234567890");
+        read_binary(text);
+        check(false, file);
+    }
+    catch (const invalid_binary_integer &e)
+    {
+        check(true, file);
+    }
+
+    file << "\nRandom Big Integers Tests:\n";
+    file << "Checking the random big integers are the same after writing and reading them ...";
+    stringstream stream;
+    for (const big_int &number : numbers)
+    {
+        write_binary(stream, number);
+    }
+    bool same = true;
+    for (const big_int &number : numbers)
+    {
+        same = same && read_binary(stream) == number;
+    }
+    check(same, file);
+
+    // Write the product of the 1st random negative and positive big integer to a file and map it
+    string path = (filesystem::temp_directory_path() / "big_int_binary_test.bin").string();
+    save_binary(path, numbers[0] * numbers[2]);
+
+    file << "Checking the product is the same after loading it from a file ...";
+    check(products[2] == print_base10(load_binary(path)), file);
+
+#ifdef BIG_INT_MAPPED_VIEW
+    file << "Checking a memory mapped view of the product ...";
+    {
+        big_int_view view(path);
+        big_int product = numbers[0] * numbers[2];
+        check(view == product && view.get_sign() == sign::NEGATIVE && view.coefficient_size() == product.coefficient_size() && view.at(0) == product.at(0), file);
+
+        file << "Checking the comparison of a memory mapped view with the random big integers ...";
+        check(view.compare(numbers[2]) < 0 && view.compare(numbers[0]) < 0 && !(view == numbers[2]), file);
+
+        file << "Checking a memory mapped view is copied into a big_int ...";
+        big_int_view moved(std::move(view));
+        check(products[2] == print_base10(moved.to_big_int()) && view == big_int(), file);
+    }
+#endif
+    filesystem::remove(path);
+}
+
+/**
+ * @brief Test the conversion of big integers to and from strings in other radixes
+ * @param numbers A vector of 4 big integers, the 1st two are positive and the 2nd two are negative
+ * @param products A vector of strings containing the solutions to the multiplication of big integers
+ * @param file The log file to print results to
+ */
+void check_radix(const vector<big_int> &numbers, const vector<string> &products, ofstream &file)
+{
+    file << "Hard Coded tests:\n";
+    file << "Checking the hexadecimal string of 2^64 ...";
+    check("+10000000000000000" == big_int(vector<uint32_t>{1, 0, 0}).to_string(16), file);
+
+    file << "Checking a negative upper case hexadecimal string ...";
+    check(big_int::from_string("-FfFfFfFfFfFfFfFfF", 16) == big_int(vector<uint32_t>{15, UINT32_MAX, UINT32_MAX}) * big_int(-1), file);
+
+    file << "Checking octal digits that cross coefficients ...";
+    check("+37777777777" == big_int(vector<uint32_t>{UINT32_MAX}).to_string(8) && big_int::from_string("1000000000000", 8) == big_int(68719476736), file);
+
+    file << "Checking an exception is thrown for a radix of 37 ...";
+    try
+    {
+        big_int(5).to_string(37);
+        check(false, file);
+    }
+    catch (const invalid_radix &e)
+    {
+        check(true, file);
+    }
+
+    file << "Checking an exception is thrown for a digit that is not in the radix ...";
+    try
+    {
+        big_int::from_string("10201", 2);
+        check(false, file);
+    }
+    catch (const invalid_string_integer &e)
+    {
+        check(true, file);
+    }
+
+    file << "\nRandom Big Integers Tests:\n";
+    file << "Checking the random big integers are the same after converting them to hexadecimal and back ...";
+    bool same = true;
+    for (const big_int &number : numbers)
+    {
+        same = same && big_int::from_string(number.to_string(16), 16) == number;
+    }
+    check(same, file);
+
+    file << "Checking the binary string of the 1st random negative big integer has a digit per bit ...";
+    string binary = numbers[2].to_string(2);
+    check(binary[0] == '-' && binary[1] == '1' && big_int::from_string(binary, 2) == numbers[2], file);
+
+    file << "Checking the product of the 1st random negative and positive big integer in base 36 and base 10 ...";
+    big_int product = big_int::from_string(big_int(numbers[0] * numbers[2]).to_string(36), 36);
+    check(products[2] == product.to_string() && products[2] == print_base10(product), file);
+}
+
+/**
+ * @brief Test the conversion of big integers to and from buffers with to_chars and from_chars
+ * @param numbers A vector of 4 big integers, the 1st two are positive and the 2nd two are negative
+ * @param products A vector of strings containing the solutions to the multiplication of big integers
+ * @param file The log file to print results to
+ */
+void check_chars(const vector<big_int> &numbers, const vector<string> &products, ofstream &file)
+{
+    char buffer[32];
+
+    file << "Hard Coded tests:\n";
+    file << "Checking a negative integer is written without a + sign and exactly fits a buffer ...";
+    to_chars_result written = to_chars(buffer, buffer + 5, big_int(-1234));
+    check(written.ec == errc() && string(buffer, written.ptr) == "-1234", file);
+
+    file << "Checking an error is returned if the buffer is one character too small ...";
+    written = to_chars(buffer, buffer + 4, big_int(-1234));
+    check(written.ec == errc::value_too_large && written.ptr == buffer + 4, file);
+
+    file << "Checking the digits are read until the first character that is not a digit ...";
+    string text = "-ff,12";
+    big_int value;
+    from_chars_result read = from_chars(text.data(), text.data() + text.size(), value, 16);
+    check(read.ec == errc() && read.ptr == text.data() + 3 && value == big_int(-255), file);
+
+    file << "Checking an error is returned and the big integer is unchanged if there are no digits ...";
+    read = from_chars(text.data() + 3, text.data() + text.size(), value, 10);
+    check(read.ec == errc::invalid_argument && read.ptr == text.data() + 3 && value == big_int(-255), file);
+
+    file << "\nRandom Big Integers Tests:\n";
+    file << "Checking the product of the 1st random negative and positive big integer is written to a buffer of to_chars_size characters ...";
+    big_int product = numbers[0] * numbers[2];
+    vector<char> digits(to_chars_size(product));
+    written = to_chars(digits.data(), digits.data() + digits.size(), product);
+    check(written.ec == errc() && products[2].substr(1) == string(digits.data() + 1, written.ptr) && digits.size() - (written.ptr - digits.data()) <= 2, file);
+
+    file << "Checking the random big integers are the same after writing and reading them in hexadecimal ...";
+    bool same = true;
+    for (const big_int &number : numbers)
+    {
+        vector<char> hex(to_chars_size(number, 16));
+        to_chars_result hex_written = to_chars(hex.data(), hex.data() + hex.size(), number, 16);
+        big_int hex_value;
+        from_chars_result hex_read = from_chars(hex.data(), hex_written.ptr, hex_value, 16);
+        same = same && hex_written.ptr == hex.data() + hex.size() && hex_read.ptr == hex_written.ptr && hex_value == number;
+    }
+    check(same, file);
+}
+
+/**
+ * @brief Test the streaming of base 10 digits with write_base10 and stream_base10
+ * @param numbers A vector of 4 big integers, the 1st two are positive and the 2nd two are negative
+ * @param products A vector of strings containing the solutions to the multiplication of big integers
+ * @param file The log file to print results to
+ */
+void check_streaming(const vector<big_int> &numbers, const vector<string> &products, ofstream &file)
+{
+    file << "Hard Coded tests:\n";
+    file << "Checking zero and a negative integer are written to a stream ...";
+    ostringstream small;
+    write_base10(small, big_int());
+    small << ",";
+    write_base10(small, big_int(-5));
+    check(small.str() == "+0,-5", file);
+
+    file << "Checking an integer of 100000 digits is given in chunks of at most 65536 characters ...";
+    big_int power(1);
+    for (uint64_t i = 0; i < 100000 / 9; i++)
+    {
+        power = power * big_int(1000000000);
+    }
+    string digits;
+    uint64_t chunks = 0;
+    uint64_t largest = 0;
+    stream_base10(power, [&](const char *chunk, const uint64_t &count)
+                  {
+                      digits.append(chunk, count);
+                      chunks++;
+                      largest = max(largest, count); });
+    check(digits == print_base10(power) && chunks > 1 && largest <= 65536, file);
+
+    file << "\nRandom Big Integers Tests:\n";
+    file << "Checking the random big integers are written to a stream ...";
+    ostringstream out;
+    for (const big_int &number : numbers)
+    {
+        write_base10(out, number);
+    }
+    check(out.str() == print_base10(numbers[0]) + print_base10(numbers[1]) + print_base10(numbers[2]) + print_base10(numbers[3]), file);
+
+    file << "Checking the product of the 1st random negative and positive big integer is written to a stream ...";
+    ostringstream product;
+    write_base10(product, numbers[0] * numbers[2]);
+    check(products[2] == product.str(), file);
+}
+
+/**
+ * @brief Test the operation counters of big_int_stats.hpp, which only count when the library is built with
+ *        BIG_INT_INSTRUMENT
+ * @param numbers A vector of 4 big integers, the 1st two are positive and the 2nd two are negative
+ * @param products A vector of strings containing the solutions to the multiplication of big integers
+ * @param file The log file to print results to
+ */
+void check_stats(const vector<big_int> &numbers, const vector<string> &products, ofstream &file)
+{
+    // Each counted operation adds one when instrumented and nothing otherwise
+    uint64_t one = big_int_instrumented() ? 1 : 0;
+    vector<uint32_t> digits(40, 123456789);
+    big_int int_a(digits);
+    big_int int_b = int_a + big_int(1);
+
+    file << "Hard Coded tests:\n";
+    file << "Checking a reset gives zero counters ...";
+    reset_big_int_stats();
+    big_int_stats stats = big_int_stats_snapshot();
+    bool all_zero = true;
+    for (const big_int_operation_stats &operation : stats.operations)
+    {
+        all_zero = all_zero && operation.count == 0 && operation.nanoseconds == 0 && operation.allocations == 0;
+    }
+    check(all_zero, file);
+
+    file << "Checking a product is counted once with the size of its operands ...";
+    reset_big_int_stats();
+    big_int product = int_a * int_b;
+    stats = big_int_stats_snapshot();
+    check(stats[big_int_operation::MULTIPLY].count == one && stats[big_int_operation::MULTIPLY].sizes[5] == one &&
+              stats[big_int_operation::ADD].count == 0,
+          file);
+
+    file << "Checking the multiplications of a division are part of the division ...";
+    uint64_t original_division = division_threshold();
+    set_division_threshold(1);
+    reset_big_int_stats();
+    big_int quotient = product / int_a;
+    stats = big_int_stats_snapshot();
+    set_division_threshold(original_division);
+    check(quotient == int_b && stats[big_int_operation::DIVIDE].count == one && stats[big_int_operation::MULTIPLY].count == 0, file);
+
+    file << "\nRandom Big Integers Tests:\n";
+    file << "Checking the conversion of a random big integer is counted and written in JSON ...";
+    reset_big_int_stats();
+    string digits_0 = print_base10(numbers[0]);
+    ostringstream json;
+    write_stats_json(json, big_int_stats_snapshot());
+    check(json.str().find("\"to_string\": {\"count\": " + to_string(one)) != string::npos, file);
+
+    file << "Checking the product of random big integers on another thread is counted ...";
+    reset_big_int_stats();
+    string thread_product;
+    thread worker([&]
+                  { thread_product = print_base10(numbers[0] * numbers[2]); });
+    worker.join();
+    stats = big_int_stats_snapshot();
+    check(thread_product == products[2] && stats[big_int_operation::MULTIPLY].count == one, file);
+}
+
+/**
+ * @brief Test the driver of big_int_verify.hpp that checks files of many cases in the format of test_input.txt
+ * @param lines The 6 lines of the input file, each one a vector of its values
+ * @param file The log file to print results to
+ */
+void check_verify(const vector<vector<string>> &lines, ofstream &file)
+{
+    verify_options options;
+
+    file << "Hard Coded tests:\n";
+    file << "Checking the example input file of the README is verified ...";
+    istringstream example("+45,+2,-13,-5\n+47,-18,+32,-3\n+43,-58,-8\n+90,+65,-585\n+22,+2,+0\nfalse,false,true,true\n");
+    verify_report report = verify_cases(example, options);
+    check(report.records == 1 && report.checks == verify_checks_per_record && report.failed == 0, file);
+
+    file << "Checking a wrong product and a wrong comparison are reported with their lines ...";
+    istringstream wrong("\n+45,+2,-13,-5\n+47,-18,+32,-3\n+43,-58,-8\n+90,+65,+585\n+22,+2,+0\nfalse,false,true,false\n");
+    report = verify_cases(wrong, options);
+    check(report.failed == 2 && report.mismatches.size() == 2 && report.mismatches[0].line == 5 &&
+              report.mismatches[0].operation == "pos_1 * neg_1" && report.mismatches[0].actual == "-585" &&
+              report.mismatches[1].line == 7,
+          file);
+
+    file << "Checking a record with a missing value throws an exception ...";
+    istringstream missing("+45,+2,-13,-5\n+47,-18,+32,-3\n+43,-58\n+90,+65,-585\n+22,+2,+0\nfalse,false,true,true\n");
+    bool thrown = false;
+    try
+    {
+        verify_cases(missing, options);
+    }
+    catch (const invalid_case_file &)
+    {
+        thrown = true;
+    }
+    check(thrown, file);
+
+    // The input file written as one record
+    string record;
+    for (const vector<string> &line : lines)
+    {
+        for (uint64_t i = 0; i < line.size(); i++)
+        {
+            record += (i == 0 ? "" : ",") + line[i];
+        }
+        record += "\n";
+    }
+
+    file << "\nRandom Big Integers Tests:\n";
+    file << "Checking 100 copies of the random big integers are verified in chunks on 2 threads ...";
+    string copies;
+    for (uint64_t i = 0; i < 100; i++)
+    {
+        copies += record;
+    }
+    options.chunk_records = 7;
+    set_big_int_threads(2);
+    istringstream many(copies);
+    report = verify_cases(many, options);
+    set_big_int_threads(1);
+    check(report.records == 100 && report.checks == 100 * verify_checks_per_record && report.failed == 0, file);
+
+    file << "Checking a wrong quotient in the 60th copy is reported ...";
+    string wrong_quotient = lines[4][0] == "+0" ? "+1" : "+0";
+    uint64_t quotients_start = 0;
+    for (uint64_t i = 0; i < 4; i++)
+    {
+        quotients_start = record.find('\n', quotients_start) + 1;
+    }
+    string changed = record.substr(0, quotients_start) + wrong_quotient + record.substr(quotients_start + lines[4][0].size());
+    istringstream one_wrong(copies.substr(0, 59 * record.size()) + changed + copies.substr(60 * record.size()));
+    report = verify_cases(one_wrong, options);
+    check(report.records == 100 && report.failed == 1 && report.mismatches[0].record == 60 &&
+              report.mismatches[0].line == 59 * 6 + 5 && report.mismatches[0].operation == "pos_1 / pos_2",
+          file);
+
+    file << "Checking 3 copies of the random big integers in a binary case file are verified ...";
+    ostringstream binary;
+    for (uint64_t copy = 0; copy < 3; copy++)
+    {
+        for (uint64_t line = 0; line < 5; line++)
+        {
+            for (const string &value : lines[line])
+            {
+                write_binary(binary, big_int(value));
+            }
+        }
+        char comparisons[4] = {0, 0, 0, 0};
+        for (uint64_t i = 0; i < 4; i++)
+        {
+            comparisons[0] = (char)(comparisons[0] | (lines[5][i] == "true" ? 1 << i : 0));
+        }
+        binary.write(comparisons, 4);
+    }
+    istringstream binary_cases(binary.str());
+    report = verify_cases(binary_cases, options);
+    check(report.records == 3 && report.checks == 3 * verify_checks_per_record && report.failed == 0, file);
+}
+
+/**
+ * @brief Test the random big integers of big_int_random.hpp
+ * @param numbers A vector of 4 big integers, the 1st two are positive and the 2nd two are negative
+ * @param file The log file to print results to
+ */
+void check_random(const vector<big_int> &numbers, ofstream &file)
+{
+    xoshiro256_engine generator(7);
+
+    file << "Hard Coded tests:\n";
+    file << "Checking random integers of 0 and 100 bits are in range and the 100th bit is used ...";
+    big_int power(1);
+    for (uint64_t i = 0; i < 100; i++)
+    {
+        power = power * big_int(2);
+    }
+    bool in_range = random_bits(0, generator) == big_int();
+    bool top_bit = false;
+    for (uint64_t i = 0; i < 200; i++)
+    {
+        big_int value = random_bits(100, generator);
+        in_range = in_range && value < power && value.get_sign() == sign::POSITIVE;
+        top_bit = top_bit || !(value < power / big_int(2));
+    }
+    check(in_range && top_bit, file);
+
+    file << "Checking the same seed gives the same integers and mt19937 can be used ...";
+    xoshiro256_engine first(11);
+    xoshiro256_engine second(11);
+    mt19937 small_words(3);
+    big_int from_small = random_bits(1000, small_words);
+    check(random_bits(5000, first) == random_bits(5000, second) && from_small.coefficient_size() <= 32 && from_small != big_int(), file);
+
+    file << "Checking the values below 6 are uniformly distributed ...";
+    uint64_t counts[6] = {0, 0, 0, 0, 0, 0};
+    bool below_six = true;
+    for (uint64_t i = 0; i < 60000; i++)
+    {
+        big_int value = random_below(big_int(6), generator);
+        below_six = below_six && value < big_int(6) && !(value < big_int());
+        if (below_six)
+        {
+            counts[value.at(0)]++;
+        }
+    }
+    bool uniform = below_six;
+    for (const uint64_t &count : counts)
+    {
+        uniform = uniform && count > 9500 && count < 10500;
+    }
+    check(uniform, file);
+
+    file << "Checking a bound of zero or a negative bound throws an exception ...";
+    uint64_t thrown = 0;
+    for (const big_int &bound : {big_int(), big_int(-5), big_int(vector<uint32_t>{0, 0})})
+    {
+        try
+        {
+            random_below(bound, generator);
+        }
+        catch (const invalid_random_bound &)
+        {
+            thrown++;
+        }
+    }
+    check(thrown == 3, file);
+
+    file << "\nRandom Big Integers Tests:\n";
+    file << "Checking random integers below the 1st random positive big integer are in range ...";
+    in_range = true;
+    bool large = false;
+    for (uint64_t i = 0; i < 1000; i++)
+    {
+        big_int value = random_below(numbers[0], generator);
+        in_range = in_range && value < numbers[0] && value.get_sign() == sign::POSITIVE;
+        large = large || value.coefficient_size() == numbers[0].coefficient_size();
+    }
+    check(in_range && large, file);
+
+    file << "Checking random integers below a bound with leading zero coefficients are in range ...";
+    vector<uint32_t> digits(3, 0);
+    digits.push_back(7);
+    big_int padded(digits);
+    in_range = true;
+    for (uint64_t i = 0; i < 100; i++)
+    {
+        big_int value = random_below(padded, generator);
+        in_range = in_range && value < big_int(7) && value.coefficient_size() == 1;
+    }
+    check(in_range, file);
+}
+
+/**
+ * @brief Test the operators between big integers and integers of the built in types of big_int_native.hpp
+ * @param numbers A vector of 4 big integers, the 1st two are positive and the 2nd two are negative
+ * @param file The log file to print results to
+ */
+void check_native(const vector<big_int> &numbers, ofstream &file)
+{
+    file << "Hard Coded tests:\n";
+    file << "Checking adding and subtracting integers carries and borrows across coefficients and changes sign ...";
+    big_int all_ones(vector<uint32_t>{UINT32_MAX, UINT32_MAX});
+    big_int smallest("-9223372036854775808");
+    check(all_ones + 1 == big_int(vector<uint32_t>{1, 0, 0}) && big_int(vector<uint32_t>{1, 0, 0}) - 1u == all_ones &&
+              big_int(5) - 7 == big_int(-2) && big_int(-1) + 1 == big_int() && big_int() + INT64_MIN == smallest &&
+              smallest - INT64_MIN == big_int() && 3 - big_int(10) == big_int(-7) && all_ones + UINT64_MAX == all_ones * big_int(2),
+          file);
+
+    file << "Checking subtracting a zero big integer from zero gives a positive zero ...";
+    big_int zero_x(0);
+    big_int zero_difference = 0 - zero_x;
+    check(0 - big_int(0) == big_int() && zero_difference.get_sign() == sign::POSITIVE && !(zero_difference < big_int()) &&
+              int64_t(0) - big_int(0) == big_int() && 0u - zero_x == big_int() && (big_int() * -3).get_sign() == sign::POSITIVE,
+          file);
+
+    file << "Checking multiplying by 64 bit integers ...";
+    big_int largest("18446744073709551615");
+    check(all_ones * UINT64_MAX == all_ones * largest && big_int(-3) * INT64_MIN == smallest * big_int(-3) &&
+              all_ones * 0 == big_int() && (all_ones * -1).get_sign() == sign::NEGATIVE && -2 * big_int(21) == big_int(-42),
+          file);
+
+    file << "Checking division and remainder are rounded towards zero as the built in types ...";
+    bool thrown = false;
+    try
+    {
+        all_ones / 0;
+    }
+    catch (const division_by_zero &)
+    {
+        thrown = true;
+    }
+    check(thrown && big_int(-7) / 2 == big_int(-3) && big_int(-7) % 2 == big_int(-1) && big_int(7) % -2 == big_int(1) &&
+              big_int(7) / -2 == big_int(-3) && all_ones / UINT64_MAX == big_int(1) && all_ones % UINT64_MAX == big_int() &&
+              big_int(-6) % 3 == big_int() && (big_int(-6) % 3).get_sign() == sign::POSITIVE,
+          file);
+
+    file << "Checking comparisons with integers of every sign and size ...";
+    check(big_int(-1) < 0 && big_int() == 0u && 0 == big_int() && big_int(3) != 4 && 5 > big_int(4) && -5 < big_int(-4) &&
+              largest == UINT64_MAX && big_int(vector<uint32_t>{1, 0, 0}) > UINT64_MAX && smallest == INT64_MIN &&
+              smallest < INT64_MIN + 1 && big_int(vector<uint32_t>{0, 0, 5}) == (uint16_t)5,
+          file);
+
+    file << "Checking the operators can be used in constant expressions ...";
+    constexpr bool folded = big_int(5) * 3 + 1 == 16 && 100 - big_int(1) > 98 && big_int(-2) * -2 == 4u;
+    check(folded, file);
+
+    file << "\nRandom Big Integers Tests:\n";
+    file << "Checking the operators with integers give the results of the operators with big integers ...";
+    vector<int64_t> values = {1, -1, 7, -10, 4294967295, 4294967296, -4294967297, INT64_MAX, INT64_MIN};
+    bool same = true;
+    for (const big_int &number : numbers)
+    {
+        for (const int64_t &value : values)
+        {
+            big_int big_value(value);
+            big_int quotient = number / big_value;
+            same = same && number + value == number + big_value && number - value == number - big_value &&
+                   value - number == big_value - number && number * value == number * big_value && number / value == quotient &&
+                   number % value == number - quotient * big_value && (number < value) == (number < big_value) &&
+                   (number == value) == (number == big_value);
+        }
+    }
+    check(same, file);
+
+    file << "Checking the compound assignments give the same results as the binary operators ...";
+    same = true;
+    for (const big_int &number : numbers)
+    {
+        big_int result(number);
+        result += 123456789012345;
+        result *= -98765;
+        result -= 4294967296u;
+        result /= 1000003;
+        result %= 65537;
+        same = same && result == (((number + 123456789012345) * -98765 - 4294967296u) / 1000003) % 65537;
+    }
+    check(same, file);
+}
+
+/**
+ * @brief Test the three way comparison, the equality and the hash of big integers
+ * @param numbers A vector of 4 big integers, the 1st two are positive and the 2nd two are negative
+ * @param file The log file to print results to
+ */
+void check_ordering(const vector<big_int> &numbers, ofstream &file)
+{
+    file << "Hard Coded tests:\n";
+    file << "Checking <=> orders by sign, then number of coefficients, then coefficients ...";
+    big_int two_words(vector<uint32_t>{1, 0});
+    big_int one_word(UINT32_MAX);
+    check((big_int(-5) <=> big_int(3)) == strong_ordering::less && (two_words <=> one_word) == strong_ordering::greater &&
+              (big_int() - two_words <=> big_int() - one_word) == strong_ordering::less &&
+              (big_int(-7) <=> big_int(-9)) == strong_ordering::greater && (one_word <=> big_int(UINT32_MAX)) == strong_ordering::equal &&
+              big_int(4) <= big_int(4) && big_int(-4) >= big_int(-5) && !(two_words <= one_word) && one_word <= UINT32_MAX &&
+              -3 >= big_int(-3) && big_int(2) >= 1u,
+          file);
+
+    file << "Checking == rejects integers of different signs or sizes and compares the coefficients of the same size ...";
+    check(big_int(5) != big_int(-5) && two_words != one_word && two_words == big_int("4294967296") &&
+              big_int(vector<uint32_t>{7, 1, 2}) != big_int(vector<uint32_t>{7, 1, 3}) && big_int(-5) == big_int(-5),
+          file);
+
+    file << "Checking the comparisons and the hash can be used in constant expressions ...";
+    constexpr bool folded = (big_int(3) <=> big_int(-3)) > 0 && big_int(10) >= big_int(10) &&
+                            hash<big_int>{}(big_int(12345)) == hash<big_int>{}(big_int(12345));
+    check(folded, file);
+
+    file << "Checking equal integers have equal hashes, and 10000 consecutive integers and their negations have different hashes ...";
+    hash<big_int> hasher;
+    unordered_set<size_t> hashes;
+    for (int64_t i = 1; i <= 10000; i++)
+    {
+        hashes.insert(hasher(big_int(i)));
+        hashes.insert(hasher(big_int(-i)));
+    }
+    check(hasher(two_words) == hasher(big_int("4294967296")) && hasher(two_words) == hasher(one_word + 1) && hashes.size() == 20000, file);
+
+    file << "Checking big integers can be the keys of an unordered_map ...";
+    unordered_map<big_int, string> names;
+    names[big_int(1)] = "one";
+    names[two_words] = "two words";
+    names[big_int(-1)] = "minus one";
+    check(names.size() == 3 && names.at(one_word + 1) == "two words" && names.at(big_int() - 1) == "minus one" && names.count(big_int(2)) == 0, file);
+
+    file << "\nRandom Big Integers Tests:\n";
+    file << "Checking <=> agrees with <, > and == for every pair of random big integers and their negations ...";
+    vector<big_int> values;
+    for (const big_int &number : numbers)
+    {
+        values.push_back(number);
+        values.push_back(big_int() - number);
+        values.push_back(number * number);
+    }
+    bool agrees = true;
+    for (const big_int &a : values)
+    {
+        for (const big_int &b : values)
+        {
+            strong_ordering order = a <=> b;
+            agrees = agrees && (order < 0) == (a < b) && (order > 0) == (a > b) && (order == 0) == (a == b) && (a <= b) == !(a > b);
+        }
+    }
+    check(agrees, file);
+
+    file << "Checking sorting the random big integers and zero orders them from smallest to largest ...";
+    vector<big_int> sorted(values);
+    sorted.push_back(big_int());
+    sort(sorted.begin(), sorted.end());
+    bool ordered = true;
+    for (uint64_t i = 1; i < sorted.size(); i++)
+    {
+        ordered = ordered && sorted[i - 1] < sorted[i];
+    }
+    // The negations of the 2 positive integers and the 2 negative integers are below zero
+    check(ordered && sorted[4] == big_int(), file);
+
+    file << "Checking a random big integer has the hash of the same integer read from its string ...";
+    bool same = true;
+    unordered_set<big_int> set(values.begin(), values.end());
+    for (const big_int &value : values)
+    {
+        same = same && hasher(value) == hasher(big_int(print_base10(value))) && set.count(big_int(print_base10(value))) == 1;
+    }
+    check(same && set.size() == values.size(), file);
+}
+
+/**
+ * @brief Test the intern table of big_int_intern.hpp
+ * @param numbers A vector of 4 big integers, the 1st two are positive and the 2nd two are negative
+ * @param file The log file to print results to
+ */
+void check_intern(const vector<big_int> &numbers, ofstream &file)
+{
+    file << "Hard Coded tests:\n";
+    file << "Checking equal values share one interned big integer and different values do not ...";
+    big_int_intern_table table;
+    interned_big_int five = table.intern(big_int(5));
+    interned_big_int also_five = table.intern(big_int("5"));
+    interned_big_int minus_five = table.intern(big_int(-5));
+    check(five == also_five && &five.value() == &also_five.value() && !(five == minus_five) && five.value() == big_int(5) &&
+              table.size() == 2,
+          file);
+
+    file << "Checking find only returns values that are interned ...";
+    interned_big_int found;
+    bool found_five = table.find(big_int(10) - big_int(5), found) && found == five;
+    check(found_five && !table.find(big_int(6), found) && found == five && table.size() == 2, file);
+
+    file << "Checking collect removes only the values without handles ...";
+    {
+        interned_big_int seven = table.intern(big_int(7));
+        table.intern(big_int(8));
+    }
+    uint64_t removed = table.collect();
+    check(removed == 2 && table.size() == 2 && five.use_count() == 4 && table.find(big_int(-5), found), file);
+
+    file << "Checking the shared table and the hash of the handles ...";
+    unordered_set<interned_big_int> handles;
+    handles.insert(intern(big_int(12)));
+    handles.insert(intern(big_int(12)));
+    handles.insert(intern(big_int(13)));
+    check(handles.size() == 2 && interned_big_int() == intern(big_int()) && intern(big_int(12)) == *handles.find(intern(big_int(12))), file);
+
+    file << "\nRandom Big Integers Tests:\n";
+    file << "Checking interning products of random big integers computed twice stores them once without copying the moved ones ...";
+    big_int_intern_table products;
+    bool shared = true;
+    for (const big_int &a : numbers)
+    {
+        for (const big_int &b : numbers)
+        {
+            big_int product = a * b;
+            const uint32_t *digits = &product.at(0);
+            uint64_t size = products.size();
+            interned_big_int stored = products.intern(std::move(product));
+            interned_big_int again = products.intern(b * a);
+            bool moved = products.size() == size || &stored.value().at(0) == digits;
+            shared = shared && stored == again && moved && stored.value() == a * b;
+        }
+    }
+    // The products a * b and b * a are the same value
+    check(shared && products.size() == 10, file);
+
+    file << "Checking 4 threads interning the same random big integers get the same handles ...";
+    big_int_intern_table concurrent(4);
+    vector<big_int> values;
+    for (uint64_t i = 0; i < 200; i++)
+    {
+        values.push_back(numbers[i % numbers.size()] + big_int((int64_t)i));
+    }
+    vector<vector<interned_big_int>> results(4);
+    vector<thread> workers;
+    for (uint64_t t = 0; t < 4; t++)
+    {
+        workers.emplace_back([&, t]
+                             {
+                                 for (uint64_t round = 0; round < 20; round++)
+                                 {
+                                     results[t].clear();
+                                     for (uint64_t i = 0; i < values.size(); i++)
+                                     {
+                                         results[t].push_back(concurrent.intern(values[(i + 37 * t) % values.size()]));
+                                     }
+                                 } });
+    }
+    for (thread &worker : workers)
+    {
+        worker.join();
+    }
+    bool same = concurrent.size() == values.size();
+    for (uint64_t t = 1; t < 4; t++)
+    {
+        for (uint64_t i = 0; i < values.size(); i++)
+        {
+            same = same && results[t][(i + values.size() - (37 * t) % values.size()) % values.size()] == results[0][i];
+        }
+    }
+    check(same, file);
+}
+
+/**
+ * @brief Read input values into desired vector and check for invalid input
+ * @param value_vec The vector to store the values 
+ * @param line A string containing the values to store seperated by a comma
+ * @param line_num Integer indicating which line from input file the string came from
+ */
+void read_values(vector<string> &value_vec, const string &line, const uint8_t &line_num)
+{
+    string value;
+    istringstream line_stream(line);
+    // input each value in line to vector
+    while (getline(line_stream, value, ','))
+    {
+        value_vec.push_back(value);
+    }
+
+    // Check number of input values per line
+    uint64_t size = value_vec.size();
+    if (line_num == 1 || line_num == 2 || line_num == 6)
+    {
+        if (size != 4)
+        {
+            throw invalid_argument("Invalid number of integers in input file, expected 4 but got " + to_string(size) + " in line " + to_string(line_num) + "\n");
+        }
+    }
+    else
+    {
+        if (size != 3)
+        {
+            throw invalid_argument("Invalid number of integers in input file, expected 3 but got " + to_string(size) + " in line " + to_string(line_num) + "\n");
+        }
+    }
+
+    // Check all values are numbers in the vector or boolean for 6th line
+    for (const string &integers : value_vec)
+    {
+        if (line_num == 6)
+        {
+            if (integers != "true" && integers != "false")
+            {
+                throw invalid_argument("Invalid bool provided in line 6 of the input file expected either true or false but got " + integers + "\n");
+            }
+        }
+        else
+        {
+            string::const_iterator start = integers.begin();
+            // Check 1st character if + or - sign and move iterator start to next char if sign is there and string is not a single char
+            if (integers[0] == '+' || integers[0] == '-')
+            {
+                if (integers.size() != 1) // only update iterator if integer is not a single character
+                    start++;
+            }
+            // Check if line contains results and if so throw invalid argument as failed above condition but must contain a positive or negative sign
+            else if (line_num != 1)
+            {
+                throw invalid_argument("Invalid integer provided in line " + to_string(line_num) + " of the input file, all integers must contain a + or - sign\n");
+            }
+            
+            // Check rest of the values that they are digits
+            if (!all_of(start, integers.end(), ::isdigit))
+            {
+                throw invalid_argument("Invalid input provided in line " + to_string(line_num) + " of the input file, expected an integer but received: " + integers + "\n");
+            }
+        }
+    }
+}
+
+int main()
+{
+    /***************************************** Read Input File ******************************************/
+    string input_file = "test_input.txt";
+    ifstream operations_input(input_file);
+    if (!operations_input.is_open())
+    {
+        cout << "Error opening input file "
+             << "test_input.txt\n";
+        return -1;
+    }
+
+    string input_line;
+    vector<string> numbers;      // 4 big_int strings
+    vector<big_int> big_numbers; // the 4 big integers as type big_int
+    vector<string> sums;         // sums of the integers
+    vector<string> diffs;        // differences of the integers
+    vector<string> products;     // products of the integers
+    vector<string> quotients;    // quotients of the integers
+    vector<string> greater_less; // boolean for < and >
+
+    // Read 6 lines from input
+    try
+    {
+        uint8_t line_counter = 0;
+        for (uint8_t i = 1; getline(operations_input, input_line); i++)
+        {
+            switch (i)
+            {
+            case 1:
+                read_values(numbers, input_line, i);
+                break;
+            case 2:
+                read_values(sums, input_line, i);
+                break;
+            case 3:
+                read_values(diffs, input_line, i);
+                break;
+            case 4:
+                read_values(products, input_line, i);
+                break;
+            case 5:
+                read_values(quotients, input_line, i);
+                break;
+            case 6:
+                read_values(greater_less, input_line, i);
+                break;
+            default:
+                break;
+            }
+            line_counter++;
+        }
+
+        if (line_counter != 6)
+        {
+            throw invalid_argument("Invalid number of lines read, expected 6 lines but only read " + to_string(line_counter) + "\n");
+        }
+    }
+    catch (invalid_argument &exception)
+    {
+        cout << exception.what();
+        return -1;
+    }
+
+    // Close input file
+    operations_input.close();
+
+    // update the big_int vector with the four random values
+    for (const string &integers : numbers)
+    {
+        big_numbers.push_back(big_int(integers));
+    }
+
+    /***************************************** Open Log File ********************************************/
+    /* Referenced the following for filesystem class:
+           https://en.cppreference.com/w/cpp/filesystem/path
+           https://en.cppreference.com/w/cpp/filesystem/exists
+    */
+
+    // Check if log file name already exists, if so keep on appending a number to end of file name
+    string log_file_name = "log_file_big_int_tests";
+    string log_file_type = ".txt";
+    string log_file = log_file_name + log_file_type;
+    string file_path = log_file;
+    filesystem::path out_path(file_path);
+    int file_num = 1;
+    string original_log_file = log_file;
+    while (filesystem::exists(out_path))
+    {
+        log_file = log_file_name + "_" + to_string(file_num) + log_file_type;
+        file_path = log_file;
+        out_path.replace_filename(file_path);
+        file_num += 1;
+    }
+
+    // Open log file and check to ensure it opens
+    ofstream log(file_path, ios::app);
+    if (!log.is_open())
+    {
+        cout << "Error opening file " << log_file << "!\n";
+        return -1;
+    }
+
+    // Inform file writing solution to
+    if (original_log_file != log_file)
+        cout << "Original Log File " << original_log_file << " already exists and thus writing test logs to file: " << log_file << "\n";
+    else
+        cout << "Writing test logs to " << log_file << "\n";
+
+    /*********************************** Run tests and Write output to log files ****************************************/
+    log << "***********Testing all constructors of the big_int class:***********\n";
+    cout << "Testing Constructors\n";
+    check_other_constructors(log);
+    check_integer_constructor(log);
+    check_string_constructor(log);
+    number_tests_passed(log);
+    update_counters();
+
+    log << "\n***********Testing printing to a string of the big_int class:***********\n";
+    cout << "Testing printing to base 10\n";
+    check_print(numbers, log);
+    number_tests_passed(log);
     update_counters();
 
     log << "\n***********Testing addition of the big_int class:***********\n";
@@ -574,6 +2001,132 @@ int main()
     number_tests_passed(log);
     update_counters();
 
+    log << "\n************Testing expressions and compound assignment of big_int class:************\n";
+    cout << "Testing Expressions and Compound Assignment\n";
+    check_expressions(big_numbers, log);
+    number_tests_passed(log);
+    update_counters();
+
+    log << "\n************Testing multiply accumulate of big_int class:************\n";
+    cout << "Testing Multiply Accumulate\n";
+    check_multiply_accumulate(big_numbers, products, log);
+    number_tests_passed(log);
+    update_counters();
+
+    log << "\n************Testing the big_int_accumulator class:************\n";
+    cout << "Testing Accumulator\n";
+    check_accumulator(big_numbers, sums, log);
+    number_tests_passed(log);
+    update_counters();
+
+    log << "\n************Testing Karatsuba and parallel multiplication of big_int class:************\n";
+    cout << "Testing Karatsuba and Parallel Multiplication\n";
+    check_large_multiplication(big_numbers, products, log);
+    number_tests_passed(log);
+    update_counters();
+
+    log << "\n************Testing divide and conquer and parallel printing of big_int class:************\n";
+    cout << "Testing Divide and Conquer and Parallel Printing\n";
+    check_large_print(numbers, products, log);
+    number_tests_passed(log);
+    update_counters();
+
+    log << "\n************Testing divide and conquer and parallel parsing of big_int class:************\n";
+    cout << "Testing Divide and Conquer and Parallel Parsing\n";
+    check_large_parse(numbers, products, log);
+    number_tests_passed(log);
+    update_counters();
+
+    log << "\n************Testing the big_int_batch class:************\n";
+    cout << "Testing Batch Operations\n";
+    check_batch(big_numbers, sums, diffs, products, greater_less, log);
+    number_tests_passed(log);
+    update_counters();
+
+    log << "\n************Testing products, factorials and binomial coefficients:************\n";
+    cout << "Testing Products, Factorials and Binomial Coefficients\n";
+    check_combinatorics(big_numbers, products, log);
+    number_tests_passed(log);
+    update_counters();
+
+    log << "\n************Testing the fixed_big_int class template:************\n";
+    cout << "Testing Fixed Width Integers\n";
+    check_fixed_width(big_numbers, sums, diffs, products, log);
+    number_tests_passed(log);
+    update_counters();
+
+    log << "\n************Testing constant expressions and the _bi literal:************\n";
+    cout << "Testing Constant Expressions\n";
+    check_constant_expressions(numbers, products, log);
+    number_tests_passed(log);
+    update_counters();
+
+    log << "\n************Testing the shared_big_int class:************\n";
+    cout << "Testing Shared Big Integers\n";
+    check_shared(big_numbers, sums, products, log);
+    number_tests_passed(log);
+    update_counters();
+
+    log << "\n************Testing the binary format of big integers:************\n";
+    cout << "Testing Binary Reading and Writing\n";
+    check_binary(big_numbers, products, log);
+    number_tests_passed(log);
+    update_counters();
+
+    log << "\n************Testing the conversion to and from other radixes:************\n";
+    cout << "Testing Radix Conversion\n";
+    check_radix(big_numbers, products, log);
+    number_tests_passed(log);
+    update_counters();
+
+    log << "\n************Testing the conversion to and from buffers:************\n";
+    cout << "Testing to_chars and from_chars\n";
+    check_chars(big_numbers, products, log);
+    number_tests_passed(log);
+    update_counters();
+
+    log << "\n************Testing the streaming of base 10 digits:************\n";
+    cout << "Testing Streaming Output\n";
+    check_streaming(big_numbers, products, log);
+    number_tests_passed(log);
+    update_counters();
+
+    log << "\n************Testing the operation counters:************\n";
+    cout << "Testing Operation Counters\n";
+    check_stats(big_numbers, products, log);
+    number_tests_passed(log);
+    update_counters();
+
+    log << "\n************Testing the verification of case files:************\n";
+    cout << "Testing Verification of Case Files\n";
+    check_verify({numbers, sums, diffs, products, quotients, greater_less}, log);
+    number_tests_passed(log);
+    update_counters();
+
+    log << "\n************Testing the random big integers:************\n";
+    cout << "Testing Random Big Integers\n";
+    check_random(big_numbers, log);
+    number_tests_passed(log);
+    update_counters();
+
+    log << "\n************Testing the operators with built in integers:************\n";
+    cout << "Testing Operators with Built In Integers\n";
+    check_native(big_numbers, log);
+    number_tests_passed(log);
+    update_counters();
+
+    log << "\n************Testing the ordering and hash:************\n";
+    cout << "Testing Ordering and Hash\n";
+    check_ordering(big_numbers, log);
+    number_tests_passed(log);
+    update_counters();
+
+    log << "\n************Testing the intern table:************\n";
+    cout << "Testing Intern Table\n";
+    check_intern(big_numbers, log);
+    number_tests_passed(log);
+    update_counters();
+
     // Write overall total passed and failed
     log << "\n*********************************************\n";
     if (total_failed == 0)
@@ -0,0 +1,268 @@
+/**
+ * @file big_int_tune_main.cpp
+ * @author Gabrielle Ching-Johnson
+ * @brief Program that measures the thresholds between the big_int algorithms on this machine and writes them to a header
+ * @version 0.3
+ * @date Oct 18, 2026
+ *
+ * Usage: big_int_tune [--output=FILE] [--threads=N] [--min-time=SECONDS] [--repetitions=N]
+ *
+ * For each threshold the operation is timed at increasing sizes n, once with the threshold at n so the faster algorithm
+ * is used for the top level and once at n + 1 so it is not. The threshold is the first size from which the faster
+ * algorithm wins at two sizes in a row. The header (big_int_tuned.hpp by default) defines the BIG_INT_*_THRESHOLD macros
+ * read by big_int.cpp when the library is built with -DBIG_INT_TUNED_HEADER=FILE.
+ */
+
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <random>
+#include <functional>
+#include <stdexcept>
+#include <thread>
+#include "big_int_bench.hpp"
+#include "big_int.hpp"
+#include "thread_pool.hpp"
+using namespace std;
+
+// Number of sizes in a row the faster algorithm has to win at
+static const uint64_t winning_sizes = 2;
+
+/**
+ * @brief A threshold being tuned
+ */
+struct tuned_threshold
+{
+    // Name of the macro in the header
+    string macro;
+
+    // Description written to the header
+    string description;
+
+    // Sets and gets the threshold of the library
+    function<void(const uint64_t &)> set;
+    function<uint64_t()> get;
+
+    // Creates the operands for a size and returns the operation to time
+    function<function<void()>(const uint64_t &limbs)> setup;
+
+    // Smallest and largest sizes tried
+    uint64_t low;
+    uint64_t high;
+
+    // True if the threshold only matters with more than one thread
+    bool parallel;
+};
+
+/**
+ * @brief Creates a positive big integer with random coefficients, the most significant one is not zero
+ * @param limbs The number of coefficients
+ * @param seed The seed of the random numbers
+ * @return The big_int
+ */
+static big_int random_integer(const uint64_t &limbs, const uint64_t &seed)
+{
+    mt19937_64 generator(seed);
+    vector<uint32_t> digits(limbs);
+    for (uint32_t &digit : digits)
+    {
+        digit = (uint32_t)generator();
+    }
+    digits[0] |= 1;
+    return big_int(digits);
+}
+
+// Results of the timed operations are stored here so the compiler can not remove the operations
+static volatile uint64_t size_sink;
+
+/**
+ * @brief Gets the thresholds in the order they are tuned, the division and conversion use the multiplication
+ * @return The thresholds
+ */
+static vector<tuned_threshold> tuned_thresholds()
+{
+    function<function<void()>(const uint64_t &)> multiply = [](const uint64_t &limbs)
+    {
+        big_int a = random_integer(limbs, 1);
+        big_int b = random_integer(limbs, 2);
+        return function<void()>([a, b]
+                                { big_int product = a * b;
+                                  size_sink = product.coefficient_size(); });
+    };
+    function<function<void()>(const uint64_t &)> divide = [](const uint64_t &limbs)
+    {
+        big_int a = random_integer(2 * limbs, 3);
+        big_int b = random_integer(limbs, 4);
+        return function<void()>([a, b]
+                                { size_sink = (a / b).coefficient_size(); });
+    };
+    function<function<void()>(const uint64_t &)> print = [](const uint64_t &limbs)
+    {
+        big_int a = random_integer(limbs, 5);
+        return function<void()>([a]
+                                { size_sink = print_base10(a).size(); });
+    };
+
+    return {
+        {"BIG_INT_KARATSUBA_THRESHOLD", "Coefficients of the smaller integer from which multiplication uses the Karatsuba method",
+         set_karatsuba_threshold, karatsuba_threshold, multiply, 4, 512, false},
+        {"BIG_INT_PARALLEL_MULTIPLY_THRESHOLD", "Coefficients of the smaller integer from which the parts of a multiplication run in parallel",
+         set_parallel_multiply_threshold, parallel_multiply_threshold, multiply, 32, 16384, true},
+        {"BIG_INT_DIVISION_THRESHOLD", "Coefficients of the divisor and of the quotient from which division uses Barrett reduction",
+         set_division_threshold, division_threshold, divide, 8, 16384, false},
+        {"BIG_INT_CONVERSION_THRESHOLD", "Coefficients from which print_base10 uses the divide and conquer method",
+         set_conversion_threshold, conversion_threshold, print, 2, 4096, false},
+        {"BIG_INT_PARALLEL_CONVERSION_THRESHOLD", "Coefficients from which the halves of an integer are converted to a string in parallel",
+         set_parallel_conversion_threshold, parallel_conversion_threshold, print, 64, 16384, true}};
+}
+
+/**
+ * @brief Finds the size from which the faster algorithm of a threshold wins
+ * @param threshold The threshold
+ * @param options The settings of the timing
+ * @param progress The stream to report each size to
+ * @return The first size of the first run of winning_sizes sizes the faster algorithm wins at, or the largest size tried
+ *         if there is none
+ */
+static uint64_t find_crossover(const tuned_threshold &threshold, const bench_options &options, ostream &progress)
+{
+    bench_case benchmark{threshold.macro, threshold.high, threshold.setup};
+    uint64_t wins = 0;
+    uint64_t first_win = threshold.high;
+    for (uint64_t limbs = threshold.low; limbs <= threshold.high; limbs = max(limbs + 1, limbs * 5 / 4))
+    {
+        threshold.set(limbs);
+        double faster = run_benchmark(benchmark, limbs, options).min;
+        threshold.set(limbs + 1);
+        double basic = run_benchmark(benchmark, limbs, options).min;
+        progress << "  " << limbs << " limbs: " << faster << " ns with, " << basic << " ns without\n";
+
+        if (faster < basic)
+        {
+            first_win = wins == 0 ? limbs : first_win;
+            wins++;
+            if (wins == winning_sizes)
+            {
+                return first_win;
+            }
+        }
+        else
+        {
+            wins = 0;
+        }
+    }
+    return threshold.high;
+}
+
+/**
+ * @brief Gets the name of the processor of this machine
+ * @return The model name of /proc/cpuinfo, or unknown
+ */
+static string processor_name()
+{
+    ifstream cpuinfo("/proc/cpuinfo");
+    string line;
+    while (getline(cpuinfo, line))
+    {
+        if (line.compare(0, 10, "model name") == 0 && line.find(':') != string::npos)
+        {
+            return line.substr(line.find(':') + 2);
+        }
+    }
+    return "unknown";
+}
+
+/**
+ * @brief Gets the value of a command line option of the form --name=value
+ * @param argument The command line argument
+ * @param name The name of the option with its dashes and equal sign (ie --output=)
+ * @param value Set to the value of the option if the argument is the option
+ * @return True if the argument is the option
+ */
+static bool option_value(const string &argument, const string &name, string &value)
+{
+    if (argument.compare(0, name.size(), name) != 0)
+    {
+        return false;
+    }
+    value = argument.substr(name.size());
+    return true;
+}
+
+int main(int argc, char *argv[])
+{
+    bench_options options;
+    options.min_time = 0.01;
+    options.repetitions = 3;
+    string output = "big_int_tuned.hpp";
+    uint64_t threads = thread::hardware_concurrency();
+    try
+    {
+        for (int i = 1; i < argc; i++)
+        {
+            string argument = argv[i];
+            string value;
+            if (option_value(argument, "--output=", value))
+                output = value;
+            else if (option_value(argument, "--threads=", value))
+                threads = stoull(value);
+            else if (option_value(argument, "--min-time=", value))
+                options.min_time = stod(value);
+            else if (option_value(argument, "--repetitions=", value))
+                options.repetitions = max(stoull(value), 1ULL);
+            else
+                throw invalid_argument("Unknown option " + argument);
+        }
+    }
+    catch (const exception &e)
+    {
+        cerr << e.what() << "\nUsage: big_int_tune [--output=FILE] [--threads=N] [--min-time=SECONDS] [--repetitions=N]\n";
+        return 2;
+    }
+    set_big_int_threads(threads);
+    threads = big_int_threads();
+
+    vector<tuned_threshold> thresholds = tuned_thresholds();
+    vector<uint64_t> values;
+    for (const tuned_threshold &threshold : thresholds)
+    {
+        // The parallel thresholds can not be measured on one thread, their current value is kept
+        if (threshold.parallel && threads == 1)
+        {
+            values.push_back(threshold.get());
+            cerr << threshold.macro << " = " << values.back() << " (not measured on one thread)\n";
+            continue;
+        }
+        cerr << threshold.macro << ":\n";
+        values.push_back(find_crossover(threshold, options, cerr));
+
+        // The later thresholds are measured with this one set
+        threshold.set(values.back());
+        cerr << threshold.macro << " = " << values.back() << "\n";
+    }
+
+    ofstream file(output);
+    file << "#pragma once\n";
+    file << "/**\n";
+    file << " * @file " << output.substr(output.find_last_of('/') + 1) << "\n";
+    file << " * @brief Thresholds of the big_int algorithms measured by big_int_tune on " << processor_name() << " with "
+         << threads << " threads\n";
+    file << " *\n";
+    file << " * Generated by big_int_tune, build the library with -DBIG_INT_TUNED_HEADER=<path of this file> to use it.\n";
+    file << " */\n";
+    for (uint64_t i = 0; i < thresholds.size(); i++)
+    {
+        file << "\n// " << thresholds[i].description << "\n";
+        file << "#define " << thresholds[i].macro << " " << values[i] << "\n";
+    }
+    file.close();
+    if (!file)
+    {
+        cerr << "Could not write " << output << "\n";
+        return 1;
+    }
+    cout << "Wrote " << output << "\n";
+    return 0;
+}
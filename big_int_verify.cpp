@@ -0,0 +1,421 @@
+/**
+ * @file big_int_verify.cpp
+ * @author Gabrielle Ching-Johnson
+ * @brief C++ code file for the driver that checks the big_int operations against files of many cases in the format of
+ *        test_input.txt
+ * @version 0.3
+ * @date Oct 18, 2026
+ */
+
+#include <iostream>
+#include <iomanip>
+#include <sstream>
+#include <array>
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <chrono>
+#include <exception>
+#include <algorithm>
+#include <functional>
+#include "big_int_verify.hpp"
+#include "big_int.hpp"
+#include "big_int_binary.hpp"
+#include "thread_pool.hpp"
+using namespace std;
+
+// Number of lines of a record
+static const uint64_t record_lines = 6;
+
+// Number of values in each line of a record
+static const uint64_t line_values[record_lines] = {4, 4, 3, 3, 3, 4};
+
+// The operations of the lines 2 to 5 of a record, in the order of their expected results
+static const char *integer_operations[] = {"pos_1 + pos_2", "neg_1 + neg_2", "pos_1 + neg_1", "neg_2 + pos_2",
+                                           "pos_1 - pos_2", "neg_1 - pos_1", "neg_1 - neg_2",
+                                           "pos_1 * pos_2", "neg_1 * neg_2", "pos_1 * neg_1",
+                                           "pos_1 / pos_2", "neg_1 / neg_2", "neg_1 / pos_1"};
+
+// The comparisons of the 6th line of a record
+static const char *comparison_operations[] = {"pos_1 < pos_2", "pos_2 > pos_1", "neg_1 < neg_2", "neg_1 < pos_1"};
+
+// Longest integer written in full in a report, longer ones only show their first and last digits
+static const uint64_t longest_written = 64;
+
+/**
+ * @brief The lines of a record read from a case file
+ */
+struct case_record
+{
+    // Number of the record and line of the file of its first line, both start at 1 (the line is 0 if binary)
+    uint64_t number = 0;
+    uint64_t first_line = 0;
+
+    // The lines of a text record
+    array<string, record_lines> lines;
+
+    // The integers and the bits of the comparisons of a binary record
+    vector<big_int> integers;
+    uint32_t comparisons = 0;
+};
+
+/**
+ * @brief The result of checking a record
+ */
+struct record_result
+{
+    uint64_t checks = 0;
+    vector<verify_mismatch> mismatches;
+
+    // Set if the record is not in the format of test_input.txt
+    exception_ptr error;
+};
+
+/**
+ * @brief Reads the next records of a case file
+ * @details Throws the exception invalid_case_file if the file ends in the middle of a record
+ * @param in The stream to read from
+ * @param count The largest number of records to read
+ * @param records Set to the records read, it is empty at the end of the file
+ * @param line_number The number of lines read so far, updated
+ * @param record_number The number of records read so far, updated
+ * @param bytes The number of bytes read so far, updated
+ */
+static void read_records(istream &in, const uint64_t &count, vector<case_record> &records, uint64_t &line_number,
+                         uint64_t &record_number, uint64_t &bytes)
+{
+    records.clear();
+    string line;
+    while (records.size() < count)
+    {
+        // Skip the empty lines between records
+        bool found = false;
+        while (!found && getline(in, line))
+        {
+            line_number++;
+            bytes += line.size() + 1;
+            found = !line.empty() && line != "\r";
+        }
+        if (!found)
+        {
+            return;
+        }
+
+        case_record record;
+        record.number = ++record_number;
+        record.first_line = line_number;
+        record.lines[0] = move(line);
+        for (uint64_t i = 1; i < record_lines; i++)
+        {
+            if (!getline(in, record.lines[i]))
+            {
+                throw invalid_case_file(line_number, "the file ends in the middle of a record, expected 6 lines");
+            }
+            line_number++;
+            bytes += record.lines[i].size() + 1;
+        }
+        records.push_back(move(record));
+    }
+}
+
+/**
+ * @brief Reads the next records of a binary case file
+ * @details Throws the exception invalid_case_file if a record is not in the binary format or is truncated
+ * @param in The stream to read from
+ * @param count The largest number of records to read
+ * @param records Set to the records read, it is empty at the end of the file
+ * @param record_number The number of records read so far, updated
+ * @param bytes The number of bytes read so far, updated
+ */
+static void read_binary_records(istream &in, const uint64_t &count, vector<case_record> &records, uint64_t &record_number,
+                                uint64_t &bytes)
+{
+    records.clear();
+    while (records.size() < count && in.peek() != istream::traits_type::eof())
+    {
+        case_record record;
+        record.number = ++record_number;
+        try
+        {
+            for (uint64_t i = 0; i < verify_record_integers; i++)
+            {
+                record.integers.push_back(read_binary(in));
+                bytes += big_int_binary_header_size + record.integers.back().coefficient_size() * sizeof(uint32_t);
+            }
+        }
+        catch (const invalid_binary_integer &)
+        {
+            throw invalid_case_file("record " + to_string(record.number) + " is not 17 integers in the binary format");
+        }
+        unsigned char flags[4];
+        if (!in.read((char *)flags, 4))
+        {
+            throw invalid_case_file("record " + to_string(record.number) + " ends before its comparisons");
+        }
+        record.comparisons = (uint32_t)flags[0] | (uint32_t)flags[1] << 8 | (uint32_t)flags[2] << 16 | (uint32_t)flags[3] << 24;
+        bytes += 4;
+        records.push_back(move(record));
+    }
+}
+
+/**
+ * @brief Splits a line of a record into its values
+ * @details Throws the exception invalid_case_file if the line does not have the expected number of values
+ * @param line The line
+ * @param expected The number of values the line must have
+ * @param line_number The line of the file, for the exception
+ * @return The values
+ */
+static vector<string> split_values(const string &line, const uint64_t &expected, const uint64_t &line_number)
+{
+    vector<string> values;
+    string value;
+    istringstream line_stream(line);
+    while (getline(line_stream, value, ','))
+    {
+        // A file written on Windows ends its lines with a carriage return
+        if (!value.empty() && value.back() == '\r')
+        {
+            value.pop_back();
+        }
+        values.push_back(value);
+    }
+    if (values.size() != expected)
+    {
+        throw invalid_case_file(line_number, "expected " + to_string(expected) + " values but got " + to_string(values.size()));
+    }
+    return values;
+}
+
+/**
+ * @brief Parses an integer of a record
+ * @details Throws the exception invalid_case_file if the value is not an integer
+ * @param value The value
+ * @param line_number The line of the file, for the exception
+ * @return The big_int
+ */
+static big_int parse_integer(const string &value, const uint64_t &line_number)
+{
+    try
+    {
+        return big_int(value);
+    }
+    catch (const invalid_argument &)
+    {
+        throw invalid_case_file(line_number, "the value " + value + " is not an integer");
+    }
+}
+
+/**
+ * @brief Evaluates the operations of a record and compares them with the expected results
+ * @details Throws the exception invalid_case_file if the record is not in the format of test_input.txt
+ * @param record The record
+ * @return The number of results checked and the mismatches
+ */
+static record_result check_record(const case_record &record)
+{
+    // The integers and the expected results of a text record are parsed here, on the threads of the pool
+    bool binary = !record.integers.empty();
+    array<vector<string>, record_lines> values;
+    vector<big_int> parsed;
+    array<bool, 4> expected_comparisons;
+    if (!binary)
+    {
+        for (uint64_t line = 0; line < record_lines; line++)
+        {
+            values[line] = split_values(record.lines[line], line_values[line], record.first_line + line);
+        }
+        for (uint64_t line = 0; line < record_lines - 1; line++)
+        {
+            for (const string &value : values[line])
+            {
+                parsed.push_back(parse_integer(value, record.first_line + line));
+            }
+        }
+        for (uint64_t i = 0; i < 4; i++)
+        {
+            const string &value = values[5][i];
+            if (value != "true" && value != "false")
+            {
+                throw invalid_case_file(record.first_line + 5, "expected true or false but got " + value);
+            }
+            expected_comparisons[i] = value == "true";
+        }
+    }
+    else
+    {
+        for (uint64_t i = 0; i < 4; i++)
+        {
+            expected_comparisons[i] = ((record.comparisons >> i) & 1) != 0;
+        }
+    }
+    const vector<big_int> &integers = binary ? record.integers : parsed;
+    const big_int &pos_1 = integers[0];
+    const big_int &pos_2 = integers[1];
+    const big_int &neg_1 = integers[2];
+    const big_int &neg_2 = integers[3];
+    const big_int zero;
+    if (pos_1 == zero || pos_2 == zero || neg_2 == zero)
+    {
+        string reason = "a divisor of the quotients is zero in record " + to_string(record.number);
+        throw binary ? invalid_case_file(reason) : invalid_case_file(record.first_line + 4, reason);
+    }
+
+    vector<big_int> results;
+    results.reserve(13);
+    results.push_back(pos_1 + pos_2);
+    results.push_back(neg_1 + neg_2);
+    results.push_back(pos_1 + neg_1);
+    results.push_back(neg_2 + pos_2);
+    results.push_back(pos_1 - pos_2);
+    results.push_back(neg_1 - pos_1);
+    results.push_back(neg_1 - neg_2);
+    results.push_back(pos_1 * pos_2);
+    results.push_back(neg_1 * neg_2);
+    results.push_back(pos_1 * neg_1);
+    results.push_back(pos_1 / pos_2);
+    results.push_back(neg_1 / neg_2);
+    results.push_back(neg_1 / pos_1);
+
+    record_result result;
+    for (uint64_t i = 0; i < results.size(); i++)
+    {
+        // The expected results follow the 4 integers, the 4 sums are on the 2nd line and the others 3 per line
+        const big_int &expected = integers[4 + i];
+        if (!(results[i] == expected))
+        {
+            uint64_t line = i < 4 ? 1 : 2 + (i - 4) / 3;
+            result.mismatches.push_back({record.number, binary ? 0 : record.first_line + line, integer_operations[i],
+                                         binary ? print_base10(expected) : values[line][i < 4 ? i : (i - 4) % 3],
+                                         print_base10(results[i])});
+        }
+        result.checks++;
+    }
+
+    bool comparisons[4] = {pos_1 < pos_2, pos_2 > pos_1, neg_1 < neg_2, neg_1 < pos_1};
+    for (uint64_t i = 0; i < 4; i++)
+    {
+        if (expected_comparisons[i] != comparisons[i])
+        {
+            result.mismatches.push_back({record.number, binary ? 0 : record.first_line + 5, comparison_operations[i],
+                                         expected_comparisons[i] ? "true" : "false", comparisons[i] ? "true" : "false"});
+        }
+        result.checks++;
+    }
+    return result;
+}
+
+/**
+ * @brief Shortens a long integer to its first and last digits
+ * @param value The integer as written in the file
+ * @return The integer if it is short, otherwise its first and last digits and its number of digits
+ */
+static string shorten(const string &value)
+{
+    if (value.size() <= longest_written)
+    {
+        return value;
+    }
+    uint64_t digits = value.size() - (value[0] == '+' || value[0] == '-' ? 1 : 0);
+    return value.substr(0, 24) + "..." + value.substr(value.size() - 24) + " (" + to_string(digits) + " digits)";
+}
+
+verify_report verify_cases(istream &in, const verify_options &options)
+{
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    verify_report report;
+    uint64_t chunk_records = max(options.chunk_records, (uint64_t)1);
+    uint64_t line_number = 0;
+    uint64_t record_number = 0;
+    thread_pool &pool = big_int_thread_pool();
+
+    // A few tasks per thread so the threads stay busy when some records take longer
+    uint64_t task_records = max(chunk_records / (pool.size() * 4), (uint64_t)1);
+
+    vector<case_record> reading;
+    vector<case_record> evaluating;
+    vector<record_result> results;
+    bool binary = in.peek() == 'B';
+    function<void()> read_chunk = [&]
+    {
+        if (binary)
+        {
+            read_binary_records(in, chunk_records, reading, record_number, report.bytes);
+        }
+        else
+        {
+            read_records(in, chunk_records, reading, line_number, record_number, report.bytes);
+        }
+    };
+    read_chunk();
+    while (!reading.empty())
+    {
+        swap(reading, evaluating);
+        results.assign(evaluating.size(), record_result());
+        {
+            task_group group(pool);
+            for (uint64_t first = 0; first < evaluating.size(); first += task_records)
+            {
+                uint64_t last = min(first + task_records, (uint64_t)evaluating.size());
+                group.run([&evaluating, &results, first, last]
+                          {
+                              for (uint64_t i = first; i < last; i++)
+                              {
+                                  try
+                                  {
+                                      results[i] = check_record(evaluating[i]);
+                                  }
+                                  catch (const invalid_case_file &)
+                                  {
+                                      results[i].error = current_exception();
+                                  }
+                              } });
+            }
+
+            // The next chunk is read while the threads of the pool check this one
+            read_chunk();
+            group.wait();
+        }
+
+        for (record_result &result : results)
+        {
+            if (result.error)
+            {
+                rethrow_exception(result.error);
+            }
+            report.records++;
+            report.checks += result.checks;
+            report.failed += result.mismatches.size();
+            for (verify_mismatch &mismatch : result.mismatches)
+            {
+                if (report.mismatches.size() < options.max_mismatches)
+                {
+                    report.mismatches.push_back(move(mismatch));
+                }
+            }
+        }
+    }
+    report.seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    return report;
+}
+
+void write_verify_report(ostream &out, const verify_report &report)
+{
+    double seconds = max(report.seconds, 1e-9);
+    out << "Checked " << report.records << " cases (" << report.checks << " results) in " << fixed << setprecision(3)
+        << report.seconds << " s: " << setprecision(1) << (double)report.records / seconds << " cases/s, "
+        << (double)report.checks / seconds << " results/s, " << (double)report.bytes / seconds / 1e6 << " MB/s\n";
+    if (report.failed == 0)
+    {
+        out << "All results are the expected ones\n";
+        return;
+    }
+    out << report.failed << " results are not the expected ones";
+    out << (report.mismatches.size() < report.failed ? ", the first " + to_string(report.mismatches.size()) + " are:\n" : ":\n");
+    for (const verify_mismatch &mismatch : report.mismatches)
+    {
+        out << "  case " << mismatch.record << (mismatch.line == 0 ? "" : " (line " + to_string(mismatch.line) + ")") << ": "
+            << mismatch.operation << " expected "
+            << shorten(mismatch.expected) << " but got " << shorten(mismatch.actual) << "\n";
+    }
+}
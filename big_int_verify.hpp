@@ -0,0 +1,117 @@
+#pragma once
+/**
+ * @file big_int_verify.hpp
+ * @author Gabrielle Ching-Johnson
+ * @brief Header file for the driver that checks the big_int operations against files of many cases in the format of
+ *        test_input.txt
+ * @version 0.3
+ * @date Oct 18, 2026
+ */
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <stdexcept>
+using namespace std;
+
+/*
+ * A case file is made of records of 6 lines in the format of test_input.txt (see the README): the 4 integers
+ * pos_1, pos_2, neg_1, neg_2 followed by the expected sums, differences, products, quotients and comparisons. Empty
+ * lines between the records are ignored, thus files written by create_random_nums.py can be concatenated.
+ *
+ * A binary case file (written by create_random_nums.py --binary) avoids parsing the base 10 integers. Each record is
+ * the 17 integers of the first 5 lines of a text record, in the same order, in the format of big_int_binary.hpp,
+ * followed by a 4 byte little endian word where bit i is set if the i-th comparison of the 6th line is true. A file
+ * starting with the magic characters "BINT" of the binary format is read as a binary case file.
+ *
+ * The file is read in chunks of records. The records of a chunk are parsed and evaluated on the threads of the pool
+ * (see thread_pool.hpp) while the next chunk is read, and every result is compared with its expected value. Only a
+ * chunk and the one being read are kept in memory, thus files of millions of cases can be checked.
+ */
+
+// Number of results checked in each record
+constexpr uint64_t verify_checks_per_record = 17;
+
+// Number of integers in a record of a binary case file, the 4 integers and the expected results of the operations
+constexpr uint64_t verify_record_integers = 17;
+
+/***************************** Exceptions ***************************/
+/**
+ * @brief Exception to be thrown if a case file is not in the format of test_input.txt
+ */
+class invalid_case_file : public invalid_argument
+{
+public:
+    invalid_case_file(const uint64_t &line, const string &reason)
+        : invalid_argument("Invalid case file at line " + to_string(line) + ": " + reason){};
+
+    invalid_case_file(const string &reason) : invalid_argument("Invalid case file: " + reason){};
+};
+
+/**
+ * @brief Settings of a verification run
+ */
+struct verify_options
+{
+    // Number of records read and evaluated together
+    uint64_t chunk_records = 4096;
+
+    // Largest number of mismatches kept in the report, the others are only counted
+    uint64_t max_mismatches = 20;
+};
+
+/**
+ * @brief A result that is not the expected one
+ */
+struct verify_mismatch
+{
+    // Number of the record, the first one is 1
+    uint64_t record = 0;
+
+    // Line of the file with the expected result, the first one is 1, or 0 in a binary case file
+    uint64_t line = 0;
+
+    // The operation (ie "pos_1 * neg_1")
+    string operation;
+
+    // The expected and the computed results, in base 10 with their sign
+    string expected;
+    string actual;
+};
+
+/**
+ * @brief The result of a verification run
+ */
+struct verify_report
+{
+    // Number of records and of results checked
+    uint64_t records = 0;
+    uint64_t checks = 0;
+
+    // Number of results that are not the expected ones
+    uint64_t failed = 0;
+
+    // The first mismatches, in the order of the file
+    vector<verify_mismatch> mismatches;
+
+    // Number of bytes read and seconds taken
+    uint64_t bytes = 0;
+    double seconds = 0;
+};
+
+/**
+ * @brief Checks the records of a case file
+ * @details Throws the exception invalid_case_file if the file is not in the format of test_input.txt
+ * @param in The stream to read the records from
+ * @param options The settings of the run
+ * @return The number of records and results checked, and the mismatches
+ */
+verify_report verify_cases(istream &in, const verify_options &options);
+
+/**
+ * @brief Writes the throughput and the mismatches of a verification run, the long integers are shortened
+ * @param out The stream to write to
+ * @param report The result of the run
+ */
+void write_verify_report(ostream &out, const verify_report &report);
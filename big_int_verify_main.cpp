@@ -0,0 +1,104 @@
+/**
+ * @file big_int_verify_main.cpp
+ * @author Gabrielle Ching-Johnson
+ * @brief Program that checks the big_int operations against files of many cases in the format of test_input.txt
+ * @version 0.3
+ * @date Oct 18, 2026
+ *
+ * Usage: big_int_verify [--threads=N] [--chunk=N] [--max-mismatches=N] [FILE...]
+ *
+ * Every file (test_input.txt if none is given, - for the standard input) is checked in turn and its throughput and
+ * mismatches are written to the standard output. The exit status is 0 if every result is the expected one, 1 if there
+ * is a mismatch and 2 if a file can not be read or is not in the format of test_input.txt.
+ */
+
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <stdexcept>
+#include "big_int_verify.hpp"
+#include "thread_pool.hpp"
+using namespace std;
+
+/**
+ * @brief Gets the value of a command line option of the form --name=value
+ * @param argument The command line argument
+ * @param name The name of the option with its dashes and equal sign (ie --chunk=)
+ * @param value Set to the value of the option if the argument is the option
+ * @return True if the argument is the option
+ */
+static bool option_value(const string &argument, const string &name, string &value)
+{
+    if (argument.compare(0, name.size(), name) != 0)
+    {
+        return false;
+    }
+    value = argument.substr(name.size());
+    return true;
+}
+
+int main(int argc, char *argv[])
+{
+    verify_options options;
+    vector<string> files;
+    try
+    {
+        for (int i = 1; i < argc; i++)
+        {
+            string argument = argv[i];
+            string value;
+            if (option_value(argument, "--threads=", value))
+                set_big_int_threads(stoull(value));
+            else if (option_value(argument, "--chunk=", value))
+                options.chunk_records = max(stoull(value), 1ULL);
+            else if (option_value(argument, "--max-mismatches=", value))
+                options.max_mismatches = stoull(value);
+            else if (argument.size() > 1 && argument[0] == '-')
+                throw invalid_argument("Unknown option " + argument);
+            else
+                files.push_back(argument);
+        }
+    }
+    catch (const exception &e)
+    {
+        cerr << e.what() << "\nUsage: big_int_verify [--threads=N] [--chunk=N] [--max-mismatches=N] [FILE...]\n";
+        return 2;
+    }
+    if (files.empty())
+    {
+        files.push_back("test_input.txt");
+    }
+
+    bool mismatch = false;
+    for (const string &path : files)
+    {
+        try
+        {
+            verify_report report;
+            if (path == "-")
+            {
+                report = verify_cases(cin, options);
+            }
+            else
+            {
+                ifstream file(path);
+                if (!file)
+                {
+                    throw invalid_argument("Could not read " + path);
+                }
+                report = verify_cases(file, options);
+            }
+            cout << path << ": ";
+            write_verify_report(cout, report);
+            mismatch = mismatch || report.failed != 0;
+        }
+        catch (const exception &e)
+        {
+            cerr << path << ": " << e.what() << "\n";
+            return 2;
+        }
+    }
+    return mismatch ? 1 : 0;
+}
@@ -1,75 +1,125 @@
 # @Author: Gabrielle Ching-Johnson
 # @date 17 Dec 2021
 # @brief This is a script that chooses 4 random big integers and finds solutions to arithmetic operations
-
+#
+# Without arguments it writes one set of 4 integers of up to 1024 bits to test_input.txt. It can also write many sets
+# (records) of integers of chosen sizes, in the format of test_input.txt or in the binary case format read by
+# big_int_verify (see big_int_verify.hpp):
+#
+#   python3 create_random_nums.py --count 100000 --min-bits 32 --max-bits 65536 --distribution log --seed 1 --output cases.txt
+#   python3 create_random_nums.py --count 100 --bits 4000000 --binary --output cases.bin
+
+import argparse
+import math
 import random
-
-file_name = "test_input.txt"
-
-# chose four random numbers 
-max = 2**1024 + 1
-min = -2**1024
-pos1 = random.randint(0,max + 1)
-pos2 = random.randint(0,max + 1)
-neg1 = random.randint(min, 0)
-neg2 = random.randint(min, 0)
-
-numbers = [pos1, pos2, neg1, neg2]
-
-# operations on numbers
-pos_sum = pos1 + pos2
-neg_sum = neg1 + neg2
-pos_neg_sum = pos1 + neg1
-neg_pos_sum = neg2 + pos2
-
-sums = [pos_sum, neg_sum, pos_neg_sum, neg_pos_sum]
-
-sub_pos = pos1 - pos2
-sub_neg_pos = neg1 - pos1
-sub_neg_neg = neg1 - neg2
-
-sub = [sub_pos, sub_neg_pos, sub_neg_neg]
-
-mult_pos = pos1 * pos2
-mult_neg = neg1 * neg2
-mult_pos_neg = pos1 * neg1
-
-multiply = [mult_pos, mult_neg, mult_pos_neg]
-
-div_pos = int(pos1 / pos2)
-div_neg = int(neg1 / neg2)
-div_pos_neg = int(neg1 / pos1)
-
-div = [div_pos, div_neg, div_pos_neg]
-
-great_less = [pos1 < pos2, pos2 > pos1, neg1 < neg2, neg1 < pos1]
-
-# print values to file 
-
-input_file = open(file_name, "w")
-
-# print 2 positive then 2 negative
-
-input_file.write(",".join("+" + str(i) if i >= 0 else str(i) for i in numbers) + "\n")
-
-# print addition solutions
-
-input_file.write(",".join("+" + str(i) if i >= 0 else str(i) for i in sums) + "\n")
-
-# print negation and subtraction solutions
-
-input_file.write(",".join("+" + str(i) if i >= 0 else str(i) for i in sub) + "\n")
-
-# print multiplication solutions
-
-input_file.write(",".join("+" + str(i) if i >= 0 else str(i) for i in multiply) + "\n")
-
-# print division solutions
-
-input_file.write(",".join("+" + str(i) if i >= 0 else str(i) for i in div) + "\n")
-
-# print < and > solutions
-
-input_file.write(",".join("true" if i else "false" for i in great_less))
-
-input_file.close()
\ No newline at end of file
+import struct
+import sys
+
+# python 3.11 limits the conversion of large integers to strings, the records can have millions of digits
+if hasattr(sys, "set_int_max_str_digits"):
+    sys.set_int_max_str_digits(0)
+
+
+def parse_arguments():
+    parser = argparse.ArgumentParser(description="Writes random big integers and the results of their operations")
+    parser.add_argument("--count", type=int, default=1, help="number of records of 4 integers (default 1)")
+    parser.add_argument("--bits", type=int, default=1024, help="largest number of bits of the integers (default 1024)")
+    parser.add_argument("--min-bits", type=int, help="smallest number of bits of the integers, the sizes are then chosen from --min-bits to --max-bits")
+    parser.add_argument("--max-bits", type=int, help="largest number of bits of the integers when --min-bits is given (default --bits)")
+    parser.add_argument("--distribution", choices=["uniform", "log", "sweep"], default="uniform",
+                        help="how the sizes are chosen: uniform, log (each power of 2 equally often) or sweep (doubling from --min-bits to --max-bits, record after record)")
+    parser.add_argument("--seed", type=int, help="seed of the random numbers, the same seed writes the same file")
+    parser.add_argument("--binary", action="store_true", help="write the integers in the binary case format instead of base 10")
+    parser.add_argument("--output", default="test_input.txt", help="file to write (default test_input.txt)")
+    return parser.parse_args()
+
+
+def record_bits(arguments, record):
+    # without --min-bits every integer has up to --bits bits, as the original 4 integers
+    if arguments.min_bits is None:
+        return None
+    low = max(arguments.min_bits, 1)
+    high = max(arguments.max_bits if arguments.max_bits is not None else arguments.bits, low)
+    if arguments.distribution == "uniform":
+        return random.randint(low, high)
+    if arguments.distribution == "log":
+        return min(high, int(round(2 ** random.uniform(math.log2(low), math.log2(high)))))
+    steps = int(math.log2(high // low)) + 1
+    return min(high, low << (record % steps))
+
+
+def random_magnitude(arguments, bits):
+    # a magnitude of exactly the chosen number of bits, or up to --bits bits chosen uniformly
+    if bits is None:
+        return random.randint(1, 2**arguments.bits)
+    return random.getrandbits(bits) | (1 << (bits - 1))
+
+
+def truncated_quotient(dividend, divisor):
+    # the quotient rounded towards zero as the big_int division, python rounds // towards minus infinity
+    quotient = abs(dividend) // abs(divisor)
+    return quotient if (dividend < 0) == (divisor < 0) else -quotient
+
+
+def record_values(arguments, record):
+    # chose four random numbers, the divisors are never zero
+    bits = record_bits(arguments, record)
+    pos1 = random_magnitude(arguments, bits)
+    pos2 = random_magnitude(arguments, bits)
+    neg1 = -random_magnitude(arguments, bits)
+    neg2 = -random_magnitude(arguments, bits)
+
+    numbers = [pos1, pos2, neg1, neg2]
+
+    # operations on numbers
+    sums = [pos1 + pos2, neg1 + neg2, pos1 + neg1, neg2 + pos2]
+    sub = [pos1 - pos2, neg1 - pos1, neg1 - neg2]
+    multiply = [pos1 * pos2, neg1 * neg2, pos1 * neg1]
+    div = [truncated_quotient(pos1, pos2), truncated_quotient(neg1, neg2), truncated_quotient(neg1, pos1)]
+    great_less = [pos1 < pos2, pos2 > pos1, neg1 < neg2, neg1 < pos1]
+
+    return [numbers, sums, sub, multiply, div], great_less
+
+
+def write_text(output, lines, great_less, last):
+    # print the integers with their sign then the < and > solutions, one line each
+    for values in lines:
+        output.write(",".join("+" + str(i) if i >= 0 else str(i) for i in values) + "\n")
+    output.write(",".join("true" if i else "false" for i in great_less) + ("" if last else "\n"))
+
+
+def write_binary_integer(output, value):
+    # the binary format of big_int_binary.hpp, zero has one coefficient
+    magnitude = abs(value)
+    coefficients = max((magnitude.bit_length() + 31) // 32, 1)
+    output.write(b"BINT" + struct.pack("<IQ", 1 if value < 0 else 0, coefficients))
+    output.write(magnitude.to_bytes(4 * coefficients, "little"))
+
+
+def write_binary(output, lines, great_less):
+    # the 17 integers then the bits of the < and > solutions
+    for values in lines:
+        for value in values:
+            write_binary_integer(output, value)
+    output.write(struct.pack("<I", sum(1 << i for i, solution in enumerate(great_less) if solution)))
+
+
+def main():
+    arguments = parse_arguments()
+    if arguments.seed is not None:
+        random.seed(arguments.seed)
+
+    with open(arguments.output, "wb" if arguments.binary else "w") as output:
+        for record in range(arguments.count):
+            lines, great_less = record_values(arguments, record)
+            if arguments.binary:
+                write_binary(output, lines, great_less)
+            else:
+                # records are separated by an empty line, the last line has no new line as the original file
+                write_text(output, lines, great_less, record == arguments.count - 1)
+                if record != arguments.count - 1:
+                    output.write("\n")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,370 @@
+#pragma once
+/**
+ * @file fixed_big_int.hpp
+ * @author Gabrielle Ching-Johnson
+ * @brief Header file for fixed width integers (ie 256 or 1024 bits) stored on the stack
+ * @version 0.3
+ * @date Oct 18, 2026
+ */
+
+#include <array>
+#include <vector>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+#include <type_traits>
+#include "big_int.hpp"
+using namespace std;
+
+/**
+ * @brief Calls step(integral_constant<uint64_t, i>) for i = 0, 1, ..., Count - 1 without a loop
+ * @details The index is a constant expression in every call, thus the compiler sees straight line code
+ * @tparam Count The number of steps
+ * @param step The function to call for each index
+ */
+template <uint64_t Count, class F>
+constexpr void unrolled(F &&step)
+{
+    [&]<uint64_t... I>(integer_sequence<uint64_t, I...>)
+    {
+        (step(integral_constant<uint64_t, I>{}), ...);
+    }(make_integer_sequence<uint64_t, Count>{});
+}
+
+/***************************** Exceptions ***************************/
+/**
+ * @brief Exception to be thrown if a big integer does not fit in the bits of a fixed_big_int
+ */
+class fixed_width_overflow : public invalid_argument
+{
+public:
+    fixed_width_overflow() : invalid_argument("The big integer does not fit in the number of bits of the fixed_big_int"){};
+};
+
+/**
+ * @brief This class stores a signed integer of exactly Bits bits in a std::array, thus it never allocates memory
+ * @details The integer is stored in two's complement with Bits / 32 coefficients in base 2^32, the least significant
+ *          first. Like the built in integers, +, - and * wrap around modulo 2^Bits. Every operation is constexpr and
+ *          its loops over the coefficients are unrolled at compile time, thus there are no branches on sizes.
+ * @tparam Bits The number of bits, a multiple of 32
+ */
+template <uint64_t Bits>
+class fixed_big_int
+{
+    static_assert(Bits > 0 && Bits % 32 == 0, "The number of bits of a fixed_big_int must be a multiple of 32");
+
+public:
+    // Number of coefficients in base 2^32
+    static constexpr uint64_t size = Bits / 32;
+
+    /************************** Constructors ****************************/
+    /**
+     * @brief Initialize a fixed width integer with value 0
+     */
+    constexpr fixed_big_int() : coefficient{} {};
+
+    /**
+     * @brief Initialize a fixed width integer from a 64 bit integer
+     * @details Values that do not fit (ie in a 32 bit fixed_big_int) wrap around
+     * @param integer a signed 64 bit integer
+     */
+    constexpr fixed_big_int(const int64_t &integer) : coefficient{}
+    {
+        uint64_t value = (uint64_t)integer;
+        uint32_t extension = integer < 0 ? UINT32_MAX : 0;
+        unrolled<size>([&](auto i)
+                       {
+                           if constexpr (decltype(i)::value < 2)
+                               coefficient[i] = (uint32_t)(value >> (32 * i));
+                           else
+                               coefficient[i] = extension; });
+    }
+
+    /**
+     * @brief Initialize a fixed width integer from its coefficients in two's complement
+     * @param coefficients The coefficients, the least significant first
+     */
+    constexpr explicit fixed_big_int(const array<uint32_t, size> &coefficients) : coefficient(coefficients){};
+
+    /**
+     * @brief Initialize a fixed width integer from a big integer
+     * @details Throws fixed_width_overflow if the big_int does not fit in Bits bits
+     * @param integer The big_int to convert
+     */
+    explicit fixed_big_int(const big_int &integer) : coefficient{}
+    {
+        bool nonzero = false;
+        for (uint64_t i = 0; i < integer.coefficient_size(); i++)
+        {
+            if (integer.at(i) != 0)
+            {
+                nonzero = true;
+                if (i >= size)
+                {
+                    throw fixed_width_overflow();
+                }
+            }
+        }
+
+        // Store the two's complement of negative integers (invert and add one)
+        bool negative = integer.get_sign() == sign::NEGATIVE && nonzero;
+        uint32_t invert = negative ? UINT32_MAX : 0;
+        uint64_t carry = negative ? 1 : 0;
+        for (uint64_t i = 0; i < size; i++)
+        {
+            uint32_t digit = i < integer.coefficient_size() ? integer.at(i) : 0;
+            uint64_t temp = (uint64_t)(digit ^ invert) + carry;
+            coefficient[i] = (uint32_t)temp;
+            carry = temp >> 32;
+        }
+
+        // The sign bit must match the sign, else the magnitude needs the sign bit
+        if (is_negative() != negative)
+        {
+            throw fixed_width_overflow();
+        }
+    }
+
+    /******************* Public Member Functions *******************/
+    /**
+     * @brief Converts the fixed width integer to a big integer
+     * @return A big_int with the same value
+     */
+    big_int to_big_int() const
+    {
+        fixed_big_int magnitude = is_negative() ? -*this : *this;
+
+        // The most negative value is its own negation, its magnitude is read as unsigned
+        uint64_t used = size;
+        while (used > 1 && magnitude.coefficient[used - 1] == 0)
+        {
+            used--;
+        }
+        vector<uint32_t> digits(magnitude.coefficient.rend() - (int64_t)used, magnitude.coefficient.rend());
+        big_int integer(digits);
+        if (is_negative())
+        {
+            integer.negate();
+        }
+        return integer;
+    }
+
+    /**
+     * @brief Gets the coefficient at an index
+     * @param index The index of the coefficient, less than size
+     * @return The coefficient in two's complement
+     */
+    constexpr const uint32_t &at(const uint64_t &index) const
+    {
+        return coefficient.at(index);
+    }
+
+    /**
+     * @brief Checks if the integer is negative
+     * @return true if the sign bit is set
+     */
+    constexpr bool is_negative() const
+    {
+        return (coefficient[size - 1] >> 31) != 0;
+    }
+
+    /**
+     * @brief Operator overload for the += (wraps around modulo 2^Bits)
+     * @param integer The fixed width integer to add
+     * @return A reference to this integer
+     */
+    constexpr fixed_big_int &operator+=(const fixed_big_int &integer)
+    {
+        uint64_t carry = 0;
+        unrolled<size>([&](auto i)
+                       {
+                           uint64_t temp = (uint64_t)coefficient[i] + integer.coefficient[i] + carry;
+                           coefficient[i] = (uint32_t)temp;
+                           carry = temp >> 32; });
+        return *this;
+    }
+
+    /**
+     * @brief Operator overload for the -= (wraps around modulo 2^Bits)
+     * @param integer The fixed width integer to subtract
+     * @return A reference to this integer
+     */
+    constexpr fixed_big_int &operator-=(const fixed_big_int &integer)
+    {
+        // a - b = a + ~b + 1 in two's complement
+        uint64_t carry = 1;
+        unrolled<size>([&](auto i)
+                       {
+                           uint64_t temp = (uint64_t)coefficient[i] + (uint32_t)~integer.coefficient[i] + carry;
+                           coefficient[i] = (uint32_t)temp;
+                           carry = temp >> 32; });
+        return *this;
+    }
+
+    /**
+     * @brief Operator overload for the *= (wraps around modulo 2^Bits)
+     * @param integer The fixed width integer to multiply by
+     * @return A reference to this integer
+     */
+    constexpr fixed_big_int &operator*=(const fixed_big_int &integer)
+    {
+        *this = *this * integer;
+        return *this;
+    }
+
+    /************************** Operator Overloads *************************/
+    /**
+     * @brief Operator overload for + (wraps around modulo 2^Bits)
+     * @param int_a The first integer to add
+     * @param int_b The second integer to add
+     * @return The sum
+     */
+    friend constexpr fixed_big_int operator+(fixed_big_int int_a, const fixed_big_int &int_b)
+    {
+        return int_a += int_b;
+    }
+
+    /**
+     * @brief Operator overload for - (wraps around modulo 2^Bits)
+     * @param int_a The integer to subtract from
+     * @param int_b The integer to subtract
+     * @return The difference
+     */
+    friend constexpr fixed_big_int operator-(fixed_big_int int_a, const fixed_big_int &int_b)
+    {
+        return int_a -= int_b;
+    }
+
+    /**
+     * @brief Negation operator overload (the most negative value is its own negation)
+     * @param int_a The integer to negate
+     * @return The negated integer
+     */
+    friend constexpr fixed_big_int operator-(const fixed_big_int &int_a)
+    {
+        return fixed_big_int() - int_a;
+    }
+
+    /**
+     * @brief Operator overload for * (wraps around modulo 2^Bits)
+     * @details The low Bits bits of the product are the same for signed and unsigned integers in two's complement,
+     *          thus only the products of coefficients that land in the low Bits bits are computed
+     * @param int_a The first integer to multiply
+     * @param int_b The second integer to multiply
+     * @return The product
+     */
+    friend constexpr fixed_big_int operator*(const fixed_big_int &int_a, const fixed_big_int &int_b)
+    {
+        fixed_big_int product;
+        unrolled<size>([&](auto i)
+                       {
+                           uint64_t carry = 0;
+                           unrolled<size - decltype(i)::value>([&](auto j)
+                                              {
+                                                  uint64_t temp = (uint64_t)int_a.coefficient[i] * int_b.coefficient[j] + product.coefficient[i + j] + carry;
+                                                  product.coefficient[i + j] = (uint32_t)temp;
+                                                  carry = temp >> 32; }); });
+        return product;
+    }
+
+    /**
+     * @brief Multiplies two fixed width integers without wrapping around
+     * @param int_a The first integer to multiply
+     * @param int_b The second integer to multiply
+     * @return The product with 2 * Bits bits
+     */
+    friend constexpr fixed_big_int<2 * Bits> full_product(const fixed_big_int &int_a, const fixed_big_int &int_b)
+    {
+        // Sign extend both integers, the low 2 * Bits bits of the product are then the exact product
+        array<uint32_t, 2 * size> wide_a{};
+        array<uint32_t, 2 * size> wide_b{};
+        uint32_t extension_a = int_a.is_negative() ? UINT32_MAX : 0;
+        uint32_t extension_b = int_b.is_negative() ? UINT32_MAX : 0;
+        unrolled<2 * size>([&](auto i)
+                           {
+                               if constexpr (decltype(i)::value < size)
+                               {
+                                   wide_a[i] = int_a.coefficient[i];
+                                   wide_b[i] = int_b.coefficient[i];
+                               }
+                               else
+                               {
+                                   wide_a[i] = extension_a;
+                                   wide_b[i] = extension_b;
+                               } });
+        return fixed_big_int<2 * Bits>(wide_a) * fixed_big_int<2 * Bits>(wide_b);
+    }
+
+    /**
+     * @brief Operator overload for ==
+     * @param int_a The first integer to compare
+     * @param int_b The second integer to compare
+     * @return A boolean value stating if int_a == int_b
+     */
+    friend constexpr bool operator==(const fixed_big_int &int_a, const fixed_big_int &int_b)
+    {
+        uint32_t difference = 0;
+        unrolled<size>([&](auto i)
+                       { difference |= int_a.coefficient[i] ^ int_b.coefficient[i]; });
+        return difference == 0;
+    }
+
+    /**
+     * @brief Operator overload for <
+     * @param int_a The first integer to compare
+     * @param int_b The second integer to compare
+     * @return A boolean value stating if int_a < int_b
+     */
+    friend constexpr bool operator<(const fixed_big_int &int_a, const fixed_big_int &int_b)
+    {
+        // Subtract with borrow, a < b if the signed difference is negative (the overflow flips the sign)
+        uint64_t borrow = 0;
+        unrolled<size - 1>([&](auto i)
+                           { borrow = ((uint64_t)int_a.coefficient[i] - int_b.coefficient[i] - borrow) >> 63; });
+        int64_t top = (int64_t)(int32_t)int_a.coefficient[size - 1] - (int32_t)int_b.coefficient[size - 1] - (int64_t)borrow;
+        return top < 0;
+    }
+
+    /**
+     * @brief Operator overload for >
+     * @param int_a The first integer to compare
+     * @param int_b The second integer to compare
+     * @return A boolean value stating if int_a > int_b
+     */
+    friend constexpr bool operator>(const fixed_big_int &int_a, const fixed_big_int &int_b)
+    {
+        return int_b < int_a;
+    }
+
+    /**
+     * @brief Operator overload for <=
+     * @param int_a The first integer to compare
+     * @param int_b The second integer to compare
+     * @return A boolean value stating if int_a <= int_b
+     */
+    friend constexpr bool operator<=(const fixed_big_int &int_a, const fixed_big_int &int_b)
+    {
+        return !(int_b < int_a);
+    }
+
+    /**
+     * @brief Operator overload for >=
+     * @param int_a The first integer to compare
+     * @param int_b The second integer to compare
+     * @return A boolean value stating if int_a >= int_b
+     */
+    friend constexpr bool operator>=(const fixed_big_int &int_a, const fixed_big_int &int_b)
+    {
+        return !(int_a < int_b);
+    }
+
+private:
+    // The coefficients in two's complement, the least significant first
+    array<uint32_t, size> coefficient;
+};
+
+// Common widths
+using int256 = fixed_big_int<256>;
+using int512 = fixed_big_int<512>;
+using int1024 = fixed_big_int<1024>;
+using int2048 = fixed_big_int<2048>;
@@ -0,0 +1,63 @@
+/**
+ * @file shared_big_int.cpp
+ * @author Gabrielle Ching-Johnson
+ * @brief C++ code file for big integers that share their coefficients between copies (copy on write)
+ * @version 0.3
+ * @date Oct 18, 2026
+ */
+
+#include <memory>
+#include <cstdint>
+#include <utility>
+#include "shared_big_int.hpp"
+using namespace std;
+
+/******************************* Constructors ******************************/
+shared_big_int::shared_big_int() : integer(make_shared<big_int>()){};
+
+shared_big_int::shared_big_int(const big_int &big_integer) : integer(make_shared<big_int>(big_integer)){};
+
+shared_big_int::shared_big_int(big_int &&big_integer) : integer(make_shared<big_int>(std::move(big_integer))){};
+
+/******************************* Public Functions ******************************/
+const big_int &shared_big_int::value() const
+{
+    return *integer;
+}
+
+shared_big_int::operator const big_int &() const
+{
+    return *integer;
+}
+
+big_int &shared_big_int::mutable_value()
+{
+    // Only this shared_big_int may see the change, copy the coefficients if another copy refers to them
+    if (integer.use_count() > 1)
+    {
+        integer = make_shared<big_int>(*integer);
+    }
+    return *integer;
+}
+
+uint64_t shared_big_int::use_count() const
+{
+    return (uint64_t)integer.use_count();
+}
+
+void shared_big_int::negate()
+{
+    mutable_value().negate();
+}
+
+shared_big_int &shared_big_int::operator+=(const big_int &big_integer)
+{
+    mutable_value() += big_integer;
+    return *this;
+}
+
+shared_big_int &shared_big_int::operator-=(const big_int &big_integer)
+{
+    mutable_value() -= big_integer;
+    return *this;
+}
@@ -0,0 +1,125 @@
+#pragma once
+/**
+ * @file shared_big_int.hpp
+ * @author Gabrielle Ching-Johnson
+ * @brief Header file for big integers that share their coefficients between copies (copy on write)
+ * @version 0.3
+ * @date Oct 18, 2026
+ */
+
+#include <memory>
+#include <cstdint>
+#include "big_int.hpp"
+using namespace std;
+
+/**
+ * @brief This class holds a big integer whose coefficients are shared by all of its copies
+ * @details Copying a shared_big_int only copies a reference counted pointer, thus it takes O(1) time whatever the size
+ *          of the integer (ie when it is stored in containers or caches). The coefficients are only copied when a
+ *          shared_big_int is changed while another copy still refers to them (copy on write), so a change is never
+ *          seen through the other copies.
+ *
+ *          A shared_big_int converts to a const big_int &, thus it can be passed to any function that takes a big_int
+ *          without a copy. In an expression (ie a + b) use value(), otherwise the operand is converted to a new big_int.
+ */
+class shared_big_int
+{
+public:
+    /************************** Constructors ****************************/
+    /**
+     * @brief Initialize a shared_big_int with value 0, not shared with any other shared_big_int
+     */
+    shared_big_int();
+
+    /**
+     * @brief Initialize a shared_big_int with a copy of a big integer
+     * @param big_integer The big_int to copy
+     */
+    shared_big_int(const big_int &big_integer);
+
+    /**
+     * @brief Initialize a shared_big_int with the coefficients of a big integer, without copying them
+     * @param big_integer The big_int to move from
+     */
+    shared_big_int(big_int &&big_integer);
+
+    /**
+     * @brief Initialize a shared_big_int by evaluating an expression (ie shared_big_int c = a * b)
+     * @param expression The expression to evaluate
+     */
+    template <class E>
+    shared_big_int(const big_int_expr<E> &expression) : shared_big_int(big_int(expression)){}
+
+    /************************** Member Functions ****************************/
+    /**
+     * @brief Gets the big integer
+     * @return A constant reference to the shared big_int
+     */
+    const big_int &value() const;
+
+    /**
+     * @brief Implicit conversion so a shared_big_int can be passed to any function that takes a big_int
+     * @return A constant reference to the shared big_int
+     */
+    operator const big_int &() const;
+
+    /**
+     * @brief Gets the big integer to change it, copying its coefficients first if other copies still refer to them
+     * @details The reference is only valid until this shared_big_int is copied or changed
+     * @return A reference to a big_int only held by this shared_big_int
+     */
+    big_int &mutable_value();
+
+    /**
+     * @brief Gets the number of shared_big_ints that share the coefficients of this one
+     * @return The number of copies including this one, 1 if it is not shared
+     */
+    uint64_t use_count() const;
+
+    /**
+     * @brief Negates the big integer
+     */
+    void negate();
+
+    /**
+     * @brief Operator overload for the +=
+     * @param big_integer A big integer to add
+     * @return A reference to this shared_big_int
+     */
+    shared_big_int &operator+=(const big_int &big_integer);
+
+    /**
+     * @brief Operator overload for the -=
+     * @param big_integer A big integer to subtract
+     * @return A reference to this shared_big_int
+     */
+    shared_big_int &operator-=(const big_int &big_integer);
+
+    /**
+     * @brief Operator overload for the += that evaluates an expression (ie x += a * b)
+     * @param expression The expression to add
+     * @return A reference to this shared_big_int
+     */
+    template <class E>
+    shared_big_int &operator+=(const big_int_expr<E> &expression)
+    {
+        mutable_value() += expression;
+        return *this;
+    }
+
+    /**
+     * @brief Operator overload for the -= that evaluates an expression (ie x -= a * b)
+     * @param expression The expression to subtract
+     * @return A reference to this shared_big_int
+     */
+    template <class E>
+    shared_big_int &operator-=(const big_int_expr<E> &expression)
+    {
+        mutable_value() -= expression;
+        return *this;
+    }
+
+private:
+    // The big integer, shared by every copy of this shared_big_int
+    shared_ptr<big_int> integer;
+};
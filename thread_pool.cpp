@@ -0,0 +1,250 @@
+/**
+ * @file thread_pool.cpp
+ * @author Gabrielle Ching-Johnson
+ * @brief C++ code file for the work-stealing thread pool used by the parallel big_int algorithms
+ * @version 0.3
+ * @date Oct 18, 2026
+ */
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include "thread_pool.hpp"
+using namespace std;
+
+// The pool the current thread belongs to (if any) and the index of its queue
+static thread_local const thread_pool *current_pool = nullptr;
+static thread_local uint64_t current_queue = 0;
+
+/******************************* Thread Pool ******************************/
+thread_pool::thread_pool(const uint64_t &threads)
+{
+    uint64_t size = threads == 0 ? 1 : threads;
+    for (uint64_t i = 0; i < size; i++)
+    {
+        queues.push_back(make_unique<task_queue>());
+    }
+
+    // The thread waiting for the tasks also runs them, thus start one less thread
+    for (uint64_t i = 1; i < size; i++)
+    {
+        workers.emplace_back(&thread_pool::worker_loop, this, i);
+    }
+}
+
+thread_pool::~thread_pool()
+{
+    {
+        lock_guard<mutex> lock(sleep_lock);
+        stopping = true;
+    }
+    wake.notify_all();
+
+    for (thread &worker : workers)
+    {
+        worker.join();
+    }
+}
+
+uint64_t thread_pool::size() const
+{
+    return queues.size();
+}
+
+void thread_pool::submit(function<void()> task)
+{
+    {
+        task_queue &queue = *queues[queue_index()];
+        lock_guard<mutex> lock(queue.lock);
+        queue.tasks.push_back(std::move(task));
+    }
+
+    // Increase the count under the sleep lock so a thread about to sleep can not miss the task
+    {
+        lock_guard<mutex> lock(sleep_lock);
+        queued++;
+    }
+    wake.notify_one();
+}
+
+bool thread_pool::run_pending_task()
+{
+    function<void()> task;
+    if (!take_task(queue_index(), task))
+    {
+        return false;
+    }
+    task();
+    return true;
+}
+
+uint64_t thread_pool::queue_index() const
+{
+    return current_pool == this ? current_queue : 0;
+}
+
+bool thread_pool::take_task(const uint64_t &index, function<void()> &task)
+{
+    if (queued == 0)
+    {
+        return false;
+    }
+
+    // Take the newest task of the own queue, it most likely uses data that is still in the cache
+    {
+        task_queue &own = *queues[index];
+        lock_guard<mutex> lock(own.lock);
+        if (!own.tasks.empty())
+        {
+            task = std::move(own.tasks.back());
+            own.tasks.pop_back();
+            queued--;
+            return true;
+        }
+    }
+
+    // Steal the oldest task of another queue, which is usually the largest piece of work left
+    for (uint64_t offset = 1; offset < queues.size(); offset++)
+    {
+        task_queue &other = *queues[(index + offset) % queues.size()];
+        lock_guard<mutex> lock(other.lock);
+        if (!other.tasks.empty())
+        {
+            task = std::move(other.tasks.front());
+            other.tasks.pop_front();
+            queued--;
+            return true;
+        }
+    }
+    return false;
+}
+
+void thread_pool::worker_loop(const uint64_t &index)
+{
+    current_pool = this;
+    current_queue = index;
+
+    while (true)
+    {
+        function<void()> task;
+        if (take_task(index, task))
+        {
+            task();
+            continue;
+        }
+
+        // Sleep until a task is submitted or the pool is stopped
+        unique_lock<mutex> lock(sleep_lock);
+        wake.wait(lock, [this]
+                  { return stopping || queued != 0; });
+        if (stopping)
+        {
+            return;
+        }
+    }
+}
+
+/******************************* Task Group ******************************/
+task_group::task_group(thread_pool &pool) : pool(pool){};
+
+task_group::~task_group()
+{
+    // Never leave tasks running that refer to the group
+    while (pending != 0)
+    {
+        if (!pool.run_pending_task())
+        {
+            this_thread::yield();
+        }
+    }
+}
+
+void task_group::run(function<void()> task)
+{
+    pending++;
+    pool.submit([this, task = std::move(task)]
+                {
+                    try
+                    {
+                        task();
+                    }
+                    catch (...)
+                    {
+                        lock_guard<mutex> lock(error_lock);
+                        if (!error)
+                        {
+                            error = current_exception();
+                        }
+                    }
+                    pending--; });
+}
+
+void task_group::wait()
+{
+    // Help running tasks (of this or any other group) instead of blocking a thread of the pool
+    while (pending != 0)
+    {
+        if (!pool.run_pending_task())
+        {
+            this_thread::yield();
+        }
+    }
+
+    if (error)
+    {
+        exception_ptr first = error;
+        error = nullptr;
+        rethrow_exception(first);
+    }
+}
+
+/******************************* Helper Functions ******************************/
+void parallel_for(thread_pool &pool, const uint64_t &count, const function<void(uint64_t)> &body)
+{
+    // Run everything on the calling thread when there is nothing to share
+    if (pool.size() == 1 || count <= 1)
+    {
+        for (uint64_t i = 0; i < count; i++)
+        {
+            body(i);
+        }
+        return;
+    }
+
+    task_group group(pool);
+    for (uint64_t i = 0; i < count; i++)
+    {
+        group.run([&body, i]
+                  { body(i); });
+    }
+    group.wait();
+}
+
+// The shared pool is only replaced by set_big_int_threads()
+static unique_ptr<thread_pool> shared_pool;
+static once_flag shared_pool_created;
+
+thread_pool &big_int_thread_pool()
+{
+    call_once(shared_pool_created, []
+              {
+                  if (!shared_pool)
+                      shared_pool = make_unique<thread_pool>(1); });
+    return *shared_pool;
+}
+
+void set_big_int_threads(const uint64_t &threads)
+{
+    uint64_t size = threads == 0 ? thread::hardware_concurrency() : threads;
+    big_int_thread_pool();
+    shared_pool.reset();
+    shared_pool = make_unique<thread_pool>(size == 0 ? 1 : size);
+}
+
+uint64_t big_int_threads()
+{
+    return big_int_thread_pool().size();
+}
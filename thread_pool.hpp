@@ -0,0 +1,168 @@
+#pragma once
+/**
+ * @file thread_pool.hpp
+ * @author Gabrielle Ching-Johnson
+ * @brief Header file for a work-stealing thread pool used by the parallel big_int algorithms
+ * @version 0.3
+ * @date Oct 18, 2026
+ */
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+using namespace std;
+
+/**
+ * @brief This class runs tasks on a fixed number of threads, where every thread has its own queue of tasks
+ * @details A thread takes the newest task of its own queue and when that is empty it steals the oldest task of
+ *          another queue. Threads that are not part of the pool (ie the main thread) share one queue. A thread that
+ *          waits for tasks (see task_group) runs queued tasks while waiting, thus tasks can start and wait for
+ *          their own tasks (ie the subproducts of a multiplication) without blocking the pool.
+ */
+class thread_pool
+{
+public:
+    /**
+     * @brief Initialize a thread pool
+     * @param threads The number of threads that run tasks, including the thread waiting for them, thus threads - 1 new threads are started
+     */
+    explicit thread_pool(const uint64_t &threads);
+
+    /**
+     * @brief Stops all threads of the pool, tasks still queued are not run
+     */
+    ~thread_pool();
+
+    thread_pool(const thread_pool &) = delete;
+    thread_pool &operator=(const thread_pool &) = delete;
+
+    /**
+     * @brief Gets the number of threads that run tasks, including the thread waiting for them
+     * @return The number of threads
+     */
+    uint64_t size() const;
+
+    /**
+     * @brief Adds a task to the queue of the calling thread
+     * @param task The task to run
+     */
+    void submit(function<void()> task);
+
+    /**
+     * @brief Runs one queued task on the calling thread
+     * @return true if a task was run and false if no task was queued
+     */
+    bool run_pending_task();
+
+private:
+    // A queue of tasks with its own lock so threads rarely wait for each other
+    struct task_queue
+    {
+        mutex lock;
+        deque<function<void()>> tasks;
+    };
+
+    // Queue 0 is shared by threads outside the pool, queue i is owned by the i-th thread of the pool
+    vector<unique_ptr<task_queue>> queues;
+    vector<thread> workers;
+
+    // Number of tasks in all queues, threads sleep while it is zero
+    atomic<uint64_t> queued{0};
+    atomic<bool> stopping{false};
+    mutex sleep_lock;
+    condition_variable wake;
+
+    /**
+     * @brief Gets the index of the queue of the calling thread
+     * @return The queue index
+     */
+    uint64_t queue_index() const;
+
+    /**
+     * @brief Takes a task from the queue of the calling thread or steals one from another queue
+     * @param index The queue of the calling thread
+     * @param task The task that was taken
+     * @return true if a task was taken
+     */
+    bool take_task(const uint64_t &index, function<void()> &task);
+
+    /**
+     * @brief The loop run by every thread of the pool
+     * @param index The queue of the thread
+     */
+    void worker_loop(const uint64_t &index);
+};
+
+/**
+ * @brief This class runs a group of tasks on a thread pool and waits for all of them to finish
+ */
+class task_group
+{
+public:
+    /**
+     * @brief Initialize an empty group of tasks
+     * @param pool The thread pool to run the tasks on
+     */
+    explicit task_group(thread_pool &pool);
+
+    /**
+     * @brief Waits for the tasks that are still running
+     */
+    ~task_group();
+
+    task_group(const task_group &) = delete;
+    task_group &operator=(const task_group &) = delete;
+
+    /**
+     * @brief Queues a task of the group
+     * @param task The task to run
+     */
+    void run(function<void()> task);
+
+    /**
+     * @brief Runs queued tasks until every task of the group is done
+     * @details Rethrows the first exception thrown by a task of the group
+     */
+    void wait();
+
+private:
+    thread_pool &pool;
+    atomic<uint64_t> pending{0};
+    mutex error_lock;
+    exception_ptr error;
+};
+
+/**
+ * @brief Runs body(i) for every i in [0, count) on a thread pool and waits for all of them to finish
+ * @param pool The thread pool to run on
+ * @param count The number of indices
+ * @param body The function to run for each index
+ */
+void parallel_for(thread_pool &pool, const uint64_t &count, const function<void(uint64_t)> &body);
+
+/**
+ * @brief Gets the thread pool shared by the parallel big_int algorithms
+ * @details It has a single thread (ie everything runs on the calling thread) until set_big_int_threads() is called
+ * @return A reference to the shared thread pool
+ */
+thread_pool &big_int_thread_pool();
+
+/**
+ * @brief Sets the number of threads used by the parallel big_int algorithms
+ * @details Must not be called while a big_int operation is running on another thread
+ * @param threads The number of threads, 0 uses the number of hardware threads
+ */
+void set_big_int_threads(const uint64_t &threads);
+
+/**
+ * @brief Gets the number of threads used by the parallel big_int algorithms
+ * @return The number of threads
+ */
+uint64_t big_int_threads();